@@ -0,0 +1,85 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/bracketed_paste.hpp"
+
+#include <curses.h>
+
+#include <stdexcept>
+
+namespace curses
+{
+
+namespace
+{
+
+constexpr const char* BeginMarker = "\033[200~";
+constexpr const char* EndMarker = "\033[201~";
+
+// Return the key code of marker, defining it as the first unused key code
+// above KEY_MAX if the terminal description doesn't already
+int DefineMarker(const char* marker, int first_keycode, bool& defined)
+{
+    defined = false;
+    const auto keycode = KeyDefined(marker);
+    if (keycode > 0) return keycode;
+    for (int candidate = first_keycode; candidate < first_keycode + 01000; ++candidate)
+    {
+        if (Keybound(candidate)) continue;
+        if (DefineKey(marker, candidate) == Result::Err) break;
+        defined = true;
+        return candidate;
+    }
+    throw std::runtime_error{"BracketedPaste can't define marker keys"};
+}
+
+} // namespace
+
+BracketedPaste::BracketedPaste()
+{
+    begin_key_ = DefineMarker(BeginMarker, KEY_MAX + 1, defined_begin_key_);
+    end_key_ = DefineMarker(EndMarker, begin_key_ + 1, defined_end_key_);
+    putp("\033[?2004h");
+}
+
+BracketedPaste::~BracketedPaste()
+{
+    putp("\033[?2004l");
+    if (defined_begin_key_) DefineKey(BeginMarker, 0);
+    if (defined_end_key_) DefineKey(EndMarker, 0);
+}
+
+std::string BracketedPaste::ReadPaste(Window& window, int timeout_ms) const
+{
+    const auto delay = window.Getdelay();
+    window.Timeout(timeout_ms);
+    auto text = std::string{};
+    while (true)
+    {
+        const auto key = window.Getch();
+        if (key == ERR || key == end_key_) break;
+        if (0 <= key && key <= 0xff) text += static_cast<char>(key);
+    }
+    window.Timeout(delay);
+    return text;
+}
+
+} // namespace curses
@@ -0,0 +1,71 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_BRACKETED_PASTE_HPP_
+#define CURSES_CPP_BRACKETED_PASTE_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <string>
+
+namespace curses
+{
+
+// BracketedPaste enables bracketed paste mode, in which the terminal
+// surrounds pasted text with ESC [ 200 ~ and ESC [ 201 ~. The markers are
+// defined as keys, so Getch returns GetBeginKey() when a paste starts, and
+// ReadPaste reads the pasted text up to the end marker as one string. The
+// receiver can then insert the whole paste and redraw once, instead of once
+// per key.
+//
+// Keypad must be enabled for the window that reads input. The mode is sent
+// to the terminal with the next refresh, and disabled by the destructor,
+// which should run before Endwin.
+class BracketedPaste
+{
+public:
+    // Throws std::runtime_error if the markers can't be defined as keys
+    BracketedPaste();
+
+    BracketedPaste(const BracketedPaste&) = delete;
+    BracketedPaste& operator=(const BracketedPaste&) = delete;
+
+    ~BracketedPaste();
+
+    int GetBeginKey() const { return begin_key_; }
+    int GetEndKey() const { return end_key_; }
+
+    // Read the pasted text after Getch returned GetBeginKey(), up to and
+    // including the end marker. Waits at most timeout_ms for each key, so
+    // that a lost end marker doesn't hang the caller. Function keys in the
+    // paste are dropped. The window's delay mode is restored afterwards.
+    std::string ReadPaste(Window& window, int timeout_ms = 1000) const;
+
+private:
+    int begin_key_ = 0;
+    int end_key_ = 0;
+    bool defined_begin_key_ = false;
+    bool defined_end_key_ = false;
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,99 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/cell_grid.hpp"
+
+#include <algorithm>
+
+namespace curses
+{
+
+CellGrid::CellGrid(SizeLinesCols lines_cols, Chtype fill)
+{
+    Resize(lines_cols, fill);
+}
+
+void CellGrid::Resize(SizeLinesCols lines_cols, Chtype fill)
+{
+    assert(lines_cols.lines >= 0 && lines_cols.cols >= 0);
+    size_ = lines_cols;
+    cells_.assign(static_cast<std::size_t>(size_.lines) * size_.cols, fill);
+}
+
+void CellGrid::Fill(Chtype ch)
+{
+    std::fill(cells_.begin(), cells_.end(), ch);
+}
+
+int CellGrid::Put(PosYx yx, std::string_view str, Attr attr)
+{
+    if (yx.y < 0 || yx.y >= size_.lines || yx.x >= size_.cols) return 0;
+    const auto skip = std::max(-yx.x, 0);
+    if (skip >= static_cast<int>(str.size())) return 0;
+    const auto n = std::min(static_cast<int>(str.size()) - skip, size_.cols - (yx.x + skip));
+    auto* out = Row(yx.y) + yx.x + skip;
+    const auto a = static_cast<unsigned>(attr);
+    for (int i = 0; i < n; ++i)
+    {
+        out[i] = Chtype{static_cast<unsigned char>(str[skip + i]) | a};
+    }
+    return n;
+}
+
+int CellGrid::Put(PosYx yx, std::basic_string_view<Chtype> str)
+{
+    if (yx.y < 0 || yx.y >= size_.lines || yx.x >= size_.cols) return 0;
+    const auto skip = std::max(-yx.x, 0);
+    if (skip >= static_cast<int>(str.size())) return 0;
+    const auto n = std::min(static_cast<int>(str.size()) - skip, size_.cols - (yx.x + skip));
+    std::copy_n(str.begin() + skip, n, Row(yx.y) + yx.x + skip);
+    return n;
+}
+
+void CellGrid::FillRect(PosYx top_left, SizeLinesCols lines_cols, Chtype ch)
+{
+    const auto y0 = std::max(top_left.y, 0);
+    const auto x0 = std::max(top_left.x, 0);
+    const auto y1 = std::min(top_left.y + lines_cols.lines, size_.lines);
+    const auto x1 = std::min(top_left.x + lines_cols.cols, size_.cols);
+    for (int y = y0; y < y1; ++y)
+    {
+        std::fill(Row(y) + x0, Row(y) + std::max(x0, x1), ch);
+    }
+}
+
+Result CellGrid::Commit(Window& window, PosYx top_left) const
+{
+    const auto window_lines = window.Getmaxyx().y;
+    const auto y0 = std::max(-top_left.y, 0);
+    const auto y1 = std::min(size_.lines, window_lines - top_left.y);
+    auto ret = Result::Ok;
+    for (int y = y0; y < y1; ++y)
+    {
+        if (window.Addchstr({top_left.y + y, top_left.x}, RowView(y)) == Result::Err)
+        {
+            ret = Result::Err;
+        }
+    }
+    return ret;
+}
+
+} // namespace curses
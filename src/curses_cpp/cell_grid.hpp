@@ -0,0 +1,94 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_CELL_GRID_HPP_
+#define CURSES_CPP_CELL_GRID_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <cassert>
+#include <string_view>
+#include <vector>
+
+namespace curses
+{
+
+// CellGrid is an off-screen, row-major matrix of Chtype that is drawn into
+// with plain array writes and committed to a Window one row at a time with
+// Window::Addchstr.
+//
+// Note that Addchstr stops at a null Chtype, so cells should not be
+// Chtype{0}. Use e.g. ' ' for blank cells.
+class CellGrid
+{
+public:
+    CellGrid() = default;
+    explicit CellGrid(SizeLinesCols lines_cols, Chtype fill = ' ');
+
+    SizeLinesCols GetSize() const { return size_; }
+    int GetLines() const { return size_.lines; }
+    int GetCols() const { return size_.cols; }
+
+    bool Contains(PosYx yx) const
+    {
+        return 0 <= yx.y && yx.y < size_.lines && 0 <= yx.x && yx.x < size_.cols;
+    }
+
+    // Resize, discarding the contents
+    void Resize(SizeLinesCols lines_cols, Chtype fill = ' ');
+    void Fill(Chtype ch);
+
+    Chtype& operator[](PosYx yx) { assert(Contains(yx)); return cells_[Index(yx)]; }
+    Chtype operator[](PosYx yx) const { assert(Contains(yx)); return cells_[Index(yx)]; }
+
+    Chtype* Row(int y) { assert(0 <= y && y < size_.lines); return cells_.data() + Index({y, 0}); }
+    const Chtype* Row(int y) const { assert(0 <= y && y < size_.lines); return cells_.data() + Index({y, 0}); }
+    std::basic_string_view<Chtype> RowView(int y) const { return {Row(y), static_cast<std::size_t>(size_.cols)}; }
+
+    Chtype* Data() { return cells_.data(); }
+    const Chtype* Data() const { return cells_.data(); }
+
+    // Write a string starting at yx. The string is clipped to the grid and
+    // does not wrap. Return the number of cells written.
+    int Put(PosYx yx, std::string_view str, Attr attr = Attr::Normal);
+    int Put(PosYx yx, std::basic_string_view<Chtype> str);
+
+    // Fill a rectangle, clipped to the grid
+    void FillRect(PosYx top_left, SizeLinesCols lines_cols, Chtype ch);
+
+    // Draw the grid in window, with the top-left cell at top_left. Each row is
+    // drawn with a single call to Window::Addchstr and is truncated at the
+    // right edge of the window. Rows below the window are skipped.
+    Result Commit(Window& window, PosYx top_left = {}) const;
+
+private:
+    std::size_t Index(PosYx yx) const
+    {
+        return static_cast<std::size_t>(yx.y) * size_.cols + yx.x;
+    }
+
+    SizeLinesCols size_{};
+    std::vector<Chtype> cells_;
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,333 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_COROUTINE_HPP_
+#define CURSES_CPP_COROUTINE_HPP_
+
+// C++20 coroutine layer. Header-only, so that it can be used from C++20
+// code while the library itself is built as C++17. Empty if the compiler
+// doesn't support coroutines.
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include "curses_cpp/curses.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace curses
+{
+
+// Task is the return type of coroutines run by TaskScheduler, for example
+//
+//     Task Confirm(TaskScheduler& scheduler, Window& window)
+//     {
+//         window.Addstr("Quit? [y/n]");
+//         while (true)
+//         {
+//             const auto key = co_await scheduler.NextKey();
+//             if (key == 'y' || key == 'n') ...
+//         }
+//     }
+//
+// A task doesn't start until it is passed to TaskScheduler::Spawn.
+class Task
+{
+public:
+    struct promise_type
+    {
+        std::exception_ptr exception;
+
+        Task get_return_object() { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { exception = std::current_exception(); }
+    };
+
+    Task(Task&& other) noexcept : handle_{std::exchange(other.handle_, {})} {}
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        if (handle_) handle_.destroy();
+    }
+
+    bool IsDone() const { return !handle_ || handle_.done(); }
+
+private:
+    friend class TaskScheduler;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_{handle} {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+// TaskScheduler runs any number of tasks on one thread. Tasks suspend on
+// the awaitables returned by NextKey, NextMouse and Sleep, and RunOnce
+// resumes them when input is read from the window or a sleep expires.
+//
+// Each key resumes every task waiting in NextKey at the time. Keys that are
+// read while no task waits are queued for the next NextKey. Each mouse event
+// resumes every task waiting in NextMouse with a mask that matches, and is
+// otherwise dropped. Key::Mouse is never returned by NextKey.
+//
+// An exception that escapes a task is rethrown by RunOnce, after the other
+// tasks that were ready have been resumed. If several tasks throw, the
+// first exception is rethrown and the others are dropped.
+class TaskScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using Handle = std::coroutine_handle<Task::promise_type>;
+
+    // Read input with window, which must outlive the scheduler. Keypad
+    // should be enabled for the window to report mouse events.
+    explicit TaskScheduler(Window& window) : window_{&window} {}
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    // Run task until its first suspension point
+    void Spawn(Task task)
+    {
+        const auto handle = task.handle_;
+        tasks_.push_back(std::move(task));
+        Resume(handle);
+        RethrowException();
+    }
+
+    auto NextKey()
+    {
+        struct Awaiter
+        {
+            TaskScheduler* scheduler;
+            int key = 0;
+
+            bool await_ready()
+            {
+                if (scheduler->pending_keys_.empty()) return false;
+                key = scheduler->pending_keys_.front();
+                scheduler->pending_keys_.pop_front();
+                return true;
+            }
+            void await_suspend(Handle handle) { scheduler->key_waiters_.push_back({handle, &key}); }
+            int await_resume() const { return key; }
+        };
+        return Awaiter{this};
+    }
+
+    // Wait for a mouse event with any of the bits in mask set
+    auto NextMouse(Mmask mask = Mmask::AllMouseEvents)
+    {
+        struct Awaiter
+        {
+            TaskScheduler* scheduler;
+            Mmask mask;
+            Mevent event{};
+
+            bool await_ready() const { return false; }
+            void await_suspend(Handle handle) { scheduler->mouse_waiters_.push_back({handle, mask, &event}); }
+            Mevent await_resume() const { return event; }
+        };
+        return Awaiter{this, mask};
+    }
+
+    auto Sleep(Clock::duration duration)
+    {
+        struct Awaiter
+        {
+            TaskScheduler* scheduler;
+            Clock::time_point deadline;
+
+            bool await_ready() const { return deadline <= Clock::now(); }
+            void await_suspend(Handle handle) { scheduler->sleepers_.push_back({deadline, handle}); }
+            void await_resume() const {}
+        };
+        return Awaiter{this, Clock::now() + duration};
+    }
+
+    // Wait at most timeout_ms, or indefinitely if negative, for input or
+    // for the next sleep to expire, and resume the tasks that are ready.
+    // Return the number of tasks that are not done.
+    int RunOnce(int timeout_ms = -1)
+    {
+        const auto delay = window_->Getdelay();
+        window_->Timeout(WaitTime(timeout_ms));
+        auto keys = std::array<int, 64>{};
+        auto mouse_events = std::array<Mevent, 64>{};
+        keys[0] = window_->Getch();
+        auto n = 0;
+        if (keys[0] != NoKey)
+        {
+            if (keys[0] == Key::Mouse) mouse_events[0] = Getmouse().value_or(Mevent{});
+            n = 1 + window_->GetchBatch(keys.data() + 1, mouse_events.data() + 1, static_cast<int>(keys.size()) - 1);
+        }
+        window_->Timeout(delay);
+
+        for (int i = 0; i < n; ++i)
+        {
+            if (keys[i] == Key::Mouse) DispatchMouse(mouse_events[i]);
+            else DispatchKey(keys[i]);
+        }
+        WakeSleepers();
+        const auto num_tasks = RemoveDone();
+        RethrowException();
+        return num_tasks;
+    }
+
+    // Run until all tasks are done
+    void Run()
+    {
+        while (RunOnce() > 0) {}
+    }
+
+    int GetNumTasks() const { return static_cast<int>(tasks_.size()); }
+
+private:
+    static constexpr int NoKey = -1;  // Returned by Getch on timeout
+
+    struct KeyWaiter
+    {
+        Handle handle;
+        int* key;
+    };
+
+    struct MouseWaiter
+    {
+        Handle handle;
+        Mmask mask;
+        Mevent* event;
+    };
+
+    struct Sleeper
+    {
+        Clock::time_point deadline;
+        Handle handle;
+    };
+
+    // Keep the first exception until RethrowException, so that a task that
+    // throws doesn't stop the others from being resumed
+    void Resume(Handle handle)
+    {
+        handle.resume();
+        auto exception = std::exchange(handle.promise().exception, {});
+        if (exception && !exception_) exception_ = std::move(exception);
+    }
+
+    void RethrowException()
+    {
+        if (exception_) std::rethrow_exception(std::exchange(exception_, {}));
+    }
+
+    int WaitTime(int timeout_ms) const
+    {
+        if (sleepers_.empty()) return timeout_ms;
+        const auto next = std::min_element(
+                sleepers_.begin(), sleepers_.end(),
+                [] (const Sleeper& a, const Sleeper& b) { return a.deadline < b.deadline; })->deadline;
+        const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(next - Clock::now()).count();
+        const auto wait = static_cast<int>(std::max<decltype(remaining)>(remaining, 0));
+        return timeout_ms < 0 ? wait : std::min(wait, timeout_ms);
+    }
+
+    void DispatchKey(int key)
+    {
+        if (key_waiters_.empty())
+        {
+            pending_keys_.push_back(key);
+            return;
+        }
+        // Swap, since the resumed tasks may wait for the next key
+        auto waiters = std::exchange(key_waiters_, {});
+        for (const auto& waiter : waiters)
+        {
+            *waiter.key = key;
+            Resume(waiter.handle);
+        }
+    }
+
+    void DispatchMouse(const Mevent& event)
+    {
+        auto waiters = std::vector<MouseWaiter>{};
+        const auto it = std::stable_partition(
+                mouse_waiters_.begin(), mouse_waiters_.end(),
+                [&] (const MouseWaiter& waiter) { return (waiter.mask & event.bstate) == Mmask{}; });
+        waiters.assign(it, mouse_waiters_.end());
+        mouse_waiters_.erase(it, mouse_waiters_.end());
+        for (const auto& waiter : waiters)
+        {
+            *waiter.event = event;
+            Resume(waiter.handle);
+        }
+    }
+
+    void WakeSleepers()
+    {
+        const auto now = Clock::now();
+        auto expired = std::vector<Sleeper>{};
+        const auto it = std::stable_partition(
+                sleepers_.begin(), sleepers_.end(),
+                [&] (const Sleeper& sleeper) { return sleeper.deadline > now; });
+        expired.assign(it, sleepers_.end());
+        sleepers_.erase(it, sleepers_.end());
+        std::stable_sort(
+                expired.begin(), expired.end(),
+                [] (const Sleeper& a, const Sleeper& b) { return a.deadline < b.deadline; });
+        for (const auto& sleeper : expired) Resume(sleeper.handle);
+    }
+
+    int RemoveDone()
+    {
+        tasks_.erase(
+                std::remove_if(tasks_.begin(), tasks_.end(), [] (const Task& task) { return task.IsDone(); }),
+                tasks_.end());
+        return static_cast<int>(tasks_.size());
+    }
+
+    Window* window_;
+    std::vector<Task> tasks_;
+    std::deque<int> pending_keys_;
+    std::vector<KeyWaiter> key_waiters_;
+    std::vector<MouseWaiter> mouse_waiters_;
+    std::vector<Sleeper> sleepers_;
+    std::exception_ptr exception_;
+};
+
+} // namespace curses
+
+#endif // __cpp_impl_coroutine
+
+#endif // Include guard
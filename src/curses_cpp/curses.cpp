@@ -20,11 +20,17 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 #include "curses_cpp/curses.hpp"
+#include "curses_cpp/build_internal/isize.hpp"
+#include "curses_cpp/curses_inline.hpp"
+#include "curses_cpp/input_latency.hpp"
 
 #include <curses.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
 
 #include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <deque>
 #include <limits>
 #include <stdexcept>
@@ -37,13 +43,6 @@ static_assert(NCURSES_VERSION_MAJOR >= 6 && NCURSES_VERSION_MINOR >= 2);
 namespace curses
 {
 
-template<typename Sized>
-static int ISize(Sized&& sized)
-{
-    assert(sized.size() <= std::numeric_limits<int>::max());
-    return static_cast<int>(sized.size());
-}
-
 namespace
 {
 
@@ -91,6 +90,23 @@ private:
     std::array<CharType, StackBufStrCap + 1> buf_;  // + 1 for trailing null
 };
 
+// Input-to-paint latency hooks, empty unless built with
+// CURSES_CPP_LATENCY_METRICS. See input_latency.hpp.
+int StampInput(int key)
+{
+#if defined(CURSES_CPP_LATENCY_METRICS)
+    if (key != ERR && key != KEY_RESIZE) detail::StampInput();
+#endif
+    return key;
+}
+
+void StampPaint()
+{
+#if defined(CURSES_CPP_LATENCY_METRICS)
+    detail::StampPaint();
+#endif
+}
+
 } // namespace
 
 AutoEndwin::AutoEndwin(AutoEndwin&& other) noexcept
@@ -168,6 +184,9 @@ Result Meta(bool enable)
     RETURN_RESULT(meta(nullptr, enable));
 }
 
+Result SetEscdelay(int ms) { RETURN_RESULT(set_escdelay(ms)); }
+int GetEscdelay() { return get_escdelay(); }
+
 void Filter() { filter(); }
 void Nofilter() { nofilter(); }
 void UseEnv(bool bf) { use_env(bf); }
@@ -269,7 +288,12 @@ ColorRgb ColorContent(Color color)
     return {r, g, b};
 }
 
-Result Doupdate() { RETURN_RESULT(doupdate()); }
+Result Doupdate()
+{
+    const auto res = doupdate();
+    StampPaint();
+    RETURN_RESULT(res);
+}
 
 Result Ungetch(int ch) { RETURN_RESULT(ungetch(ch)); }
 bool HasKey(int ch) { return static_cast<bool>(has_key(ch)); }
@@ -325,9 +349,40 @@ bool UseExtendendNames(bool enable)
     return use_extended_names(enable);
 }
 
+bool IsTermResized(SizeLinesCols lines_cols)
+{
+    return is_term_resized(lines_cols.lines, lines_cols.cols);
+}
+
+Result Resizeterm(SizeLinesCols lines_cols)
+{
+    RETURN_RESULT(resizeterm(lines_cols.lines, lines_cols.cols));
+}
+
+Result Resizeterm()
+{
+    auto size = winsize{};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == -1) return Result::Err;
+    if (size.ws_row == 0 || size.ws_col == 0) return Result::Err;
+    return Resizeterm({size.ws_row, size.ws_col});
+}
+
+Result DefineKey(const char* definition, int keycode) { RETURN_RESULT(define_key(definition, keycode)); }
+int KeyDefined(const char* definition) { return key_defined(definition); }
+
+std::optional<std::string> Keybound(int keycode, int count)
+{
+    auto* definition = keybound(keycode, count);
+    if (!definition) return std::nullopt;
+    auto ret = std::string{definition};
+    std::free(definition);
+    return ret;
+}
+
 Window::Window(const Window& other) :
     window_{dupwin(static_cast<WINDOW*>(other.window_))},
-    parent_{other.parent_}
+    parent_{other.parent_},
+    damage_{other.damage_}
 {
     if ((window_ == nullptr) != (other.window_ == nullptr))
     {
@@ -375,6 +430,18 @@ Result Window::Mvderwin(PosYx viewed_top_left)
     RETURN_RESULT(mvderwin(CHECK_GET(), viewed_top_left.y, viewed_top_left.x));
 }
 
+Result Window::Resize(SizeLinesCols lines_cols)
+{
+    const auto before = Getmaxyx();
+    const auto res = wresize(CHECK_GET(), lines_cols.lines, lines_cols.cols);
+    if (res != ERR && damage_.enabled)
+    {
+        if (lines_cols.lines > before.y) DamageRows(before.y, lines_cols.lines - 1);
+        if (lines_cols.cols > before.x) Damage({{0, before.x}, {before.y - 1, lines_cols.cols - 1}});
+    }
+    RETURN_RESULT(res);
+}
+
 Result Window::Syncok(bool enable) { RETURN_RESULT(syncok(CHECK_GET(), enable)); }
 void Window::Syncup() { wsyncup(CHECK_GET()); }
 void Window::Cursyncup() { wcursyncup(CHECK_GET()); }
@@ -413,9 +480,6 @@ Result Window::Leaveok(bool enable) { RETURN_RESULT(leaveok(CHECK_GET(), enable)
 Result Window::Scrollok(bool enable) { RETURN_RESULT(scrollok(CHECK_GET(), enable)); }
 Result Window::Setscrreg(ScrregTopBot top_bot) { RETURN_RESULT(wsetscrreg(CHECK_GET(), top_bot.top, top_bot.bot)); }
 
-Result Window::Attron(Attr attr) { RETURN_RESULT(wattron(CHECK_GET(), static_cast<int>(attr))); }
-Result Window::Attroff(Attr attr) { RETURN_RESULT(wattroff(CHECK_GET(), static_cast<int>(attr))); }
-Result Window::Attrset(Attr attr) { RETURN_RESULT(wattrset(CHECK_GET(), static_cast<int>(attr))); }
 Result Window::Colorset(int pair_number) { RETURN_RESULT(wcolor_set(CHECK_GET(), static_cast<short>(pair_number), nullptr)); }
 Attr Window::Attrget() { return static_cast<Attr>(getattrs(CHECK_GET())); }
 
@@ -424,6 +488,7 @@ Result Window::Chgat(int n, Attr attr)
 {
     const auto a = static_cast<attr_t>(RemoveColor(attr));
     const auto c = static_cast<short>(PairNumber(attr));
+    if (damage_.enabled) DamageSpan(Getyx(), n);
     RETURN_RESULT(wchgat(CHECK_GET(), n, a, c, nullptr));
 }
 
@@ -432,25 +497,56 @@ Result Window::Chgat(PosYx yx, int n, Attr attr)
 {
     const auto a = static_cast<attr_t>(RemoveColor(attr));
     const auto c = static_cast<short>(PairNumber(attr));
+    if (damage_.enabled) DamageSpan(yx, n);
     RETURN_RESULT(mvwchgat(CHECK_GET(), yx.y, yx.x, n, a, c, nullptr));
 }
 
-Result Window::Bkgd(Chtype ch) { RETURN_RESULT(wbkgd(CHECK_GET(), ch.Get())); }
+Result Window::Bkgd(Chtype ch)
+{
+    if (damage_.enabled) DamageAll();
+    RETURN_RESULT(wbkgd(CHECK_GET(), ch.Get()));
+}
+
 void Window::Bkgdset(Chtype ch) { wbkgdset(CHECK_GET(), ch.Get()); }
 Chtype Window::Getbkgd() { return Chtype{getbkgd(CHECK_GET())}; }
 
-Result Window::Erase() { RETURN_RESULT(werase(CHECK_GET())); }
-Result Window::Clear() { RETURN_RESULT(wclear(CHECK_GET())); }
-Result Window::Clrtobot() { RETURN_RESULT(wclrtobot(CHECK_GET())); }
-Result Window::Clrtoeol() { RETURN_RESULT(wclrtoeol(CHECK_GET())); }
+Result Window::Erase()
+{
+    if (damage_.enabled) DamageAll();
+    RETURN_RESULT(werase(CHECK_GET()));
+}
+
+Result Window::Clear()
+{
+    if (damage_.enabled) DamageAll();
+    RETURN_RESULT(wclear(CHECK_GET()));
+}
 
-Result Window::Refresh() { RETURN_RESULT(wrefresh(CHECK_GET())); }
+Result Window::Clrtobot()
+{
+    if (damage_.enabled) DamageRows(Getyx().y, Getmaxyx().y - 1);
+    RETURN_RESULT(wclrtobot(CHECK_GET()));
+}
+
+Result Window::Clrtoeol()
+{
+    if (damage_.enabled) DamageToEol(Getyx());
+    RETURN_RESULT(wclrtoeol(CHECK_GET()));
+}
+
+Result Window::Refresh()
+{
+    const auto res = wrefresh(CHECK_GET());
+    StampPaint();
+    RETURN_RESULT(res);
+}
 Result Window::Noutrefresh() { RETURN_RESULT(wnoutrefresh(CHECK_GET())); }
 Result Window::Redrawwin() { RETURN_RESULT(redrawwin(CHECK_GET())); }
 Result Window::Redrawln(int beg_line, int num_lines) { RETURN_RESULT(wredrawln(CHECK_GET(), beg_line, num_lines)); }
 
 Result Window::Touchwin(bool changed)
 {
+    if (changed && damage_.enabled) DamageAll();
     if (changed) RETURN_RESULT(touchwin(CHECK_GET()));
     RETURN_RESULT(untouchwin(CHECK_GET()));
 }
@@ -459,6 +555,7 @@ bool Window::IsWintouched() { return is_wintouched(CHECK_GET()); }
 
 Result Window::Touchline(int start, int count, bool changed)
 {
+    if (changed && damage_.enabled) DamageRows(start, start + count - 1);
     RETURN_RESULT(wtouchln(CHECK_GET(), start, count, changed));
 }
 Result Window::Untouchline(int start, int count) { RETURN_RESULT(wtouchln(CHECK_GET(), start, count, false)); }
@@ -466,24 +563,46 @@ bool Window::IsLinetouched(int line) { return is_linetouched(CHECK_GET(), line);
 
 Result Window::Border(const BorderSides& sides, const BorderCorners& corners)
 {
+    if (damage_.enabled) DamageAll();
     const auto res = wborder(CHECK_GET(),
             sides.l.Get(), sides.r.Get(), sides.t.Get(), sides.b.Get(),
             corners.tl.Get(), corners.tr.Get(), corners.bl.Get(), corners.br.Get());
     RETURN_RESULT(res);
 }
 
-Result Window::Hline(Chtype ch, int n) { RETURN_RESULT(whline(CHECK_GET(), ch.Get(), n)); }
-Result Window::Hline(PosYx yx, Chtype ch, int n) { RETURN_RESULT(mvwhline(CHECK_GET(), yx.y, yx.x, ch.Get(), n)); }
-Result Window::Vline(Chtype ch, int n) { RETURN_RESULT(wvline(CHECK_GET(), ch.Get(), n)); }
-Result Window::Vline(PosYx yx, Chtype ch, int n) { RETURN_RESULT(mvwvline(CHECK_GET(), yx.y, yx.x, ch.Get(), n)); }
+Result Window::Hline(Chtype ch, int n)
+{
+    if (damage_.enabled) DamageSpan(Getyx(), n);
+    RETURN_RESULT(whline(CHECK_GET(), ch.Get(), n));
+}
+
+Result Window::Hline(PosYx yx, Chtype ch, int n)
+{
+    if (damage_.enabled) DamageSpan(yx, n);
+    RETURN_RESULT(mvwhline(CHECK_GET(), yx.y, yx.x, ch.Get(), n));
+}
+
+Result Window::Vline(Chtype ch, int n)
+{
+    if (damage_.enabled) DamageVline(Getyx(), n);
+    RETURN_RESULT(wvline(CHECK_GET(), ch.Get(), n));
+}
+
+Result Window::Vline(PosYx yx, Chtype ch, int n)
+{
+    if (damage_.enabled) DamageVline(yx, n);
+    RETURN_RESULT(mvwvline(CHECK_GET(), yx.y, yx.x, ch.Get(), n));
+}
 
 Result Window::Overlay(const Window& src)
 {
+    if (damage_.enabled) DamageAll();
     RETURN_RESULT(overlay(src.Get(), CHECK_GET()));
 }
 
 Result Window::Overlay(const Window& src, PosYx src_min, PosYx dst_min, PosYx dst_max)
 {
+    if (damage_.enabled) Damage({dst_min, dst_max});
     const auto res = copywin(
             src.Get(), CHECK_GET(),
             src_min.y, src_min.x,
@@ -494,11 +613,13 @@ Result Window::Overlay(const Window& src, PosYx src_min, PosYx dst_min, PosYx ds
 
 Result Window::Overwrite(const Window& src)
 {
+    if (damage_.enabled) DamageAll();
     RETURN_RESULT(overwrite(src.Get(), CHECK_GET()));
 }
 
 Result Window::Overwrite(const Window& src, PosYx src_min, PosYx dst_min, PosYx dst_max)
 {
+    if (damage_.enabled) Damage({dst_min, dst_max});
     const auto res = copywin(
             src.Get(), CHECK_GET(),
             src_min.y, src_min.x,
@@ -507,15 +628,6 @@ Result Window::Overwrite(const Window& src, PosYx src_min, PosYx dst_min, PosYx
     RETURN_RESULT(res);
 }
 
-Result Window::Move(PosYx yx) { RETURN_RESULT(wmove(CHECK_GET(), yx.y, yx.x)); }
-
-PosYx Window::Getyx()
-{
-    auto ret = PosYx{};
-    getyx(CHECK_GET(), ret.y, ret.x);
-    return ret;
-}
-
 PosYx Window::Getparyx()
 {
     auto ret = PosYx{};
@@ -537,8 +649,37 @@ PosYx Window::Getmaxyx()
     return ret;
 }
 
-int Window::Getch() { return wgetch(CHECK_GET()); }
-int Window::Getch(PosYx yx) { return mvwgetch(CHECK_GET(), yx.y, yx.x); }
+int Window::Getch() { return StampInput(wgetch(CHECK_GET())); }
+int Window::Getch(PosYx yx) { return StampInput(mvwgetch(CHECK_GET(), yx.y, yx.x)); }
+
+int Window::GetchBatch(int* keys, int cap)
+{
+    return GetchBatch(keys, nullptr, cap);
+}
+
+int Window::GetchBatch(int* keys, Mevent* mouse_events, int cap)
+{
+    assert(keys && cap >= 0);
+    auto* window = CHECK_GET();
+    const auto delay = wgetdelay(window);
+    nodelay(window, true);
+    auto n = 0;
+    for (; n < cap; ++n)
+    {
+        const auto key = StampInput(wgetch(window));
+        if (key == ERR) break;
+        keys[n] = key;
+        if (mouse_events && key == KEY_MOUSE)
+        {
+            auto event = MEVENT{};
+            mouse_events[n] = getmouse(&event) == OK ?
+                    Mevent{event.id, event.x, event.y, event.z, static_cast<Mmask>(event.bstate)} :
+                    Mevent{};
+        }
+    }
+    wtimeout(window, delay);
+    return n;
+}
 
 std::string Window::Getstr(int maxlen)
 {
@@ -556,59 +697,112 @@ std::string Window::Getstr(PosYx yx, int maxlen)
     return std::move(buf).Str();
 }
 
-Result Window::Addch(Chtype ch) { RETURN_RESULT(waddch(CHECK_GET(), ch.Get())); }
-Result Window::Addch(PosYx yx, Chtype ch) { RETURN_RESULT(mvwaddch(CHECK_GET(), yx.y, yx.x, ch.Get())); }
-Result Window::Echochar(Chtype ch) { RETURN_RESULT(wechochar(CHECK_GET(), ch.Get())); }
+int Window::Getstr(char* buf, int cap)
+{
+    assert(buf && cap > 0);
+    const auto res = wgetnstr(CHECK_GET(), buf, cap - 1);
+    if (res != OK) return 0;
+    return static_cast<int>(std::char_traits<char>::length(buf));
+}
 
-Result Window::Addchstr(std::basic_string_view<Chtype> str)
+int Window::Getstr(PosYx yx, char* buf, int cap)
 {
-    static_assert(sizeof(Chtype) == sizeof(unsigned), "no padding in Chtype");
-    const auto res = waddchnstr(
-            CHECK_GET(),
-            reinterpret_cast<const chtype*>(str.data()),
-            ISize(str));
-    RETURN_RESULT(res);
+    assert(buf && cap > 0);
+    const auto res = mvwgetnstr(CHECK_GET(), yx.y, yx.x, buf, cap - 1);
+    if (res != OK) return 0;
+    return static_cast<int>(std::char_traits<char>::length(buf));
 }
 
-Result Window::Addchstr(PosYx yx, std::basic_string_view<Chtype> str)
+Result Window::Echochar(Chtype ch)
 {
-    static_assert(sizeof(Chtype) == sizeof(unsigned), "no padding in Chtype");
-    const auto res = mvwaddchnstr(
-            CHECK_GET(),
-            yx.y, yx.x,
-            reinterpret_cast<const chtype*>(str.data()),
-            ISize(str));
+    if (!damage_.enabled) RETURN_RESULT(wechochar(CHECK_GET(), ch.Get()));
+    const auto before = Getyx();
+    const auto res = wechochar(CHECK_GET(), ch.Get());
+    DamageCursorMoved(before, res == ERR);
     RETURN_RESULT(res);
 }
 
 Result Window::Addstr(std::string_view str)
 {
-    RETURN_RESULT(waddnstr(CHECK_GET(), str.data(), ISize(str)));
+    if (!damage_.enabled) RETURN_RESULT(waddnstr(CHECK_GET(), str.data(), ISize(str)));
+    const auto before = Getyx();
+    const auto res = waddnstr(CHECK_GET(), str.data(), ISize(str));
+    DamageCursorMoved(before, res == ERR);
+    RETURN_RESULT(res);
 }
 
 Result Window::Addstr(PosYx yx, std::string_view str)
 {
-    RETURN_RESULT(mvwaddnstr(CHECK_GET(), yx.y, yx.x, str.data(), ISize(str)));
+    if (!damage_.enabled) RETURN_RESULT(mvwaddnstr(CHECK_GET(), yx.y, yx.x, str.data(), ISize(str)));
+    const auto res = mvwaddnstr(CHECK_GET(), yx.y, yx.x, str.data(), ISize(str));
+    DamageCursorMoved(yx, res == ERR);
+    RETURN_RESULT(res);
+}
+
+Result Window::Addstr(std::string_view str, Attr attr)
+{
+    return Addstr(Getyx(), str, attr);
+}
+
+Result Window::Addstr(PosYx yx, std::string_view str, Attr attr)
+{
+    // Pack and draw in chunks to avoid allocation
+    std::array<Chtype, 256> buf; // NOLINT: No need to initialize
+    if (str.size() <= buf.size())
+    {
+        PackChtype(str, attr, buf.data());
+        return Addchstr(yx, {buf.data(), str.size()});
+    }
+    const auto start = yx;
+    const auto cols = Getmaxyx().x;
+    auto ret = Result::Ok;
+    while (!str.empty() && yx.x < cols)
+    {
+        const auto n = std::min(str.size(), buf.size());
+        PackChtype(str.substr(0, n), attr, buf.data());
+        if (Addchstr(yx, {buf.data(), n}) == Result::Err) ret = Result::Err;
+        str.remove_prefix(n);
+        yx.x += static_cast<int>(n);
+    }
+    Move(start);
+    return ret;
+}
+
+Result Window::Insch(Chtype ch)
+{
+    if (damage_.enabled) DamageToEol(Getyx());
+    RETURN_RESULT(winsch(CHECK_GET(), ch.Get()));
 }
 
-Result Window::Insch(Chtype ch) { RETURN_RESULT(winsch(CHECK_GET(), ch.Get())); }
-Result Window::Insch(PosYx yx, Chtype ch) { RETURN_RESULT(mvwinsch(CHECK_GET(), yx.y, yx.x, ch.Get())); }
+Result Window::Insch(PosYx yx, Chtype ch)
+{
+    if (damage_.enabled) DamageToEol(yx);
+    RETURN_RESULT(mvwinsch(CHECK_GET(), yx.y, yx.x, ch.Get()));
+}
 
 Result Window::Insstr(std::string_view str)
 {
+    if (damage_.enabled) DamageInsstr(Getyx(), str);
     RETURN_RESULT(winsnstr(CHECK_GET(), str.data(), ISize(str)));
 }
 
 Result Window::Insstr(PosYx yx, std::string_view str)
 {
+    if (damage_.enabled) DamageInsstr(yx, str);
     RETURN_RESULT(mvwinsnstr(CHECK_GET(), yx.y, yx.x, str.data(), ISize(str)));
 }
 
-Result Window::Delch() { RETURN_RESULT(wdelch(CHECK_GET())); }
-Result Window::Delch(PosYx yx) { RETURN_RESULT(mvwdelch(CHECK_GET(), yx.y, yx.x)); }
+Result Window::Delch()
+{
+    if (damage_.enabled) DamageToEol(Getyx());
+    RETURN_RESULT(wdelch(CHECK_GET()));
+}
 
-Chtype Window::Inch() { return Chtype{winch(CHECK_GET())}; }
-Chtype Window::Inch(PosYx yx) { return Chtype{mvwinch(CHECK_GET(), yx.y, yx.x)}; }
+Result Window::Delch(PosYx yx)
+{
+    if (damage_.enabled) DamageToEol(yx);
+    RETURN_RESULT(mvwdelch(CHECK_GET(), yx.y, yx.x));
+}
 
 std::basic_string<Chtype> Window::Inchstr(int maxlen)
 {
@@ -628,6 +822,22 @@ std::basic_string<Chtype> Window::Inchstr(PosYx yx, int maxlen)
     return std::move(buf).Str();
 }
 
+int Window::Inchstr(Chtype* buf, int cap)
+{
+    assert(buf && cap > 0);
+    const auto res = winchnstr(CHECK_GET(), reinterpret_cast<chtype*>(buf), cap - 1);
+    if (res == ERR) return 0;
+    return static_cast<int>(std::find(buf, buf + cap - 1, Chtype{0U}) - buf);
+}
+
+int Window::Inchstr(PosYx yx, Chtype* buf, int cap)
+{
+    assert(buf && cap > 0);
+    const auto res = mvwinchnstr(CHECK_GET(), yx.y, yx.x, reinterpret_cast<chtype*>(buf), cap - 1);
+    if (res == ERR) return 0;
+    return static_cast<int>(std::find(buf, buf + cap - 1, Chtype{0U}) - buf);
+}
+
 std::string Window::Instr(int n)
 {
     auto buf = StringBuffer<1024>{n};
@@ -644,11 +854,43 @@ std::string Window::Instr(PosYx yx, int n)
     return std::move(buf).Str();
 }
 
-Result Window::Scroll(int n) { RETURN_RESULT(wscrl(CHECK_GET(), n)); }
+int Window::Instr(char* buf, int cap)
+{
+    assert(buf && cap > 0);
+    const auto res = winnstr(CHECK_GET(), buf, cap - 1);
+    return res == ERR ? 0 : res;
+}
+
+int Window::Instr(PosYx yx, char* buf, int cap)
+{
+    assert(buf && cap > 0);
+    const auto res = mvwinnstr(CHECK_GET(), yx.y, yx.x, buf, cap - 1);
+    return res == ERR ? 0 : res;
+}
+
+Result Window::Scroll(int n)
+{
+    if (damage_.enabled) DamageAll();
+    RETURN_RESULT(wscrl(CHECK_GET(), n));
+}
+
+Result Window::Deleteln()
+{
+    if (damage_.enabled) DamageRows(Getyx().y, Getmaxyx().y - 1);
+    RETURN_RESULT(wdeleteln(CHECK_GET()));
+}
 
-Result Window::Deleteln() { RETURN_RESULT(wdeleteln(CHECK_GET())); }
-Result Window::Insertln() { RETURN_RESULT(winsertln(CHECK_GET())); }
-Result Window::Insdelln(int n) { RETURN_RESULT(winsdelln(CHECK_GET(), n)); }
+Result Window::Insertln()
+{
+    if (damage_.enabled) DamageRows(Getyx().y, Getmaxyx().y - 1);
+    RETURN_RESULT(winsertln(CHECK_GET()));
+}
+
+Result Window::Insdelln(int n)
+{
+    if (damage_.enabled) DamageRows(Getyx().y, Getmaxyx().y - 1);
+    RETURN_RESULT(winsdelln(CHECK_GET(), n));
+}
 
 bool Window::Enclose(PosYx pos_on_screen) const
 {
@@ -669,6 +911,100 @@ PosYx Window::TransformToScreen(PosYx pos_in_window) const
     return ret;
 }
 
+void Window::TrackDamage(bool enable)
+{
+    damage_.enabled = enable;
+    damage_.damaged = false;
+}
+
+std::optional<RectMinMax> Window::GetDamage() const
+{
+    if (!damage_.damaged) return std::nullopt;
+    return damage_.rect;
+}
+
+Result Window::FlushDamage()
+{
+    if (!damage_.damaged) return Result::Ok;
+    const auto res = Noutrefresh();
+    if (res == Result::Ok) ClearDamage();
+    return res;
+}
+
+void Window::Damage(RectMinMax rect)
+{
+    const auto [h, w] = Getmaxyx();
+    rect.min.y = std::max(rect.min.y, 0);
+    rect.min.x = std::max(rect.min.x, 0);
+    rect.max.y = std::min(rect.max.y, h - 1);
+    rect.max.x = std::min(rect.max.x, w - 1);
+    if (rect.min.y > rect.max.y || rect.min.x > rect.max.x) return;
+    if (!damage_.damaged)
+    {
+        damage_.rect = rect;
+        damage_.damaged = true;
+        return;
+    }
+    auto& d = damage_.rect;
+    d.min.y = std::min(d.min.y, rect.min.y);
+    d.min.x = std::min(d.min.x, rect.min.x);
+    d.max.y = std::max(d.max.y, rect.max.y);
+    d.max.x = std::max(d.max.x, rect.max.x);
+}
+
+void Window::DamageRows(int first, int last)
+{
+    Damage({{first, 0}, {last, std::numeric_limits<int>::max()}});
+}
+
+void Window::DamageAll()
+{
+    DamageRows(0, std::numeric_limits<int>::max());
+}
+
+void Window::DamageToEol(PosYx yx)
+{
+    Damage({yx, {yx.y, std::numeric_limits<int>::max()}});
+}
+
+void Window::DamageSpan(PosYx begin, int n)
+{
+    // Negative n means to the end of the line, see e.g. curs_attr(3X)
+    if (n < 0) return DamageToEol(begin);
+    if (n == 0) return;
+    // Clamp before adding, so that a large n doesn't overflow
+    n = std::min(n, Getmaxyx().x - begin.x);
+    Damage({begin, {begin.y, begin.x + n - 1}});
+}
+
+void Window::DamageVline(PosYx begin, int n)
+{
+    n = std::min(n, Getmaxyx().y - begin.y);
+    if (n <= 0) return;
+    Damage({begin, {begin.y + n - 1, begin.x}});
+}
+
+void Window::DamageInsstr(PosYx begin, std::string_view str)
+{
+    // A newline in the string inserts lines below
+    if (str.find('\n') != std::string_view::npos) return DamageRows(begin.y, Getmaxyx().y - 1);
+    DamageToEol(begin);
+}
+
+void Window::DamageCursorMoved(PosYx before, bool failed)
+{
+    // The cells from before up to the current cursor position were written.
+    // If the cursor wrapped to another line, damage whole lines, and if it
+    // moved backwards, the window may have scrolled, so damage all of it.
+    // Output that fails at the bottom-right corner writes the cell under
+    // the cursor and then fails to advance it, so damage that cell too.
+    const auto after = Getyx();
+    if (failed) Damage({after, after});
+    if (after.y == before.y && after.x >= before.x) return Damage({before, {after.y, std::max(after.x - 1, before.x)}});
+    if (after.y > before.y) return DamageRows(before.y, after.y);
+    DamageAll();
+}
+
 Window Window::SubwinImpl(
         SizeLinesCols lines_cols,
         PosYx top_left,
@@ -688,4 +1024,41 @@ Window Window::SubwinImpl(
     return ret;
 }
 
+Pad::Pad(SizeLinesCols lines_cols)
+{
+    window_ = newpad(lines_cols.lines, lines_cols.cols);
+    if (!window_)
+    {
+        throw std::runtime_error{"newpad failed"};
+    }
+}
+
+Pad Pad::Subpad(SizeLinesCols lines_cols, PosYx top_left_in_parent)
+{
+    return Pad{SubwinImpl(lines_cols, top_left_in_parent, "subpad")};
+}
+
+Result Pad::Prefresh(PosYx pad_min, PosYx screen_min, PosYx screen_max)
+{
+    const auto res = prefresh(
+            CHECK_GET(),
+            pad_min.y, pad_min.x,
+            screen_min.y, screen_min.x,
+            screen_max.y, screen_max.x);
+    StampPaint();
+    RETURN_RESULT(res);
+}
+
+Result Pad::Pnoutrefresh(PosYx pad_min, PosYx screen_min, PosYx screen_max)
+{
+    const auto res = pnoutrefresh(
+            CHECK_GET(),
+            pad_min.y, pad_min.x,
+            screen_min.y, screen_min.x,
+            screen_max.y, screen_max.x);
+    RETURN_RESULT(res);
+}
+
+Result Pad::Pechochar(Chtype ch) { RETURN_RESULT(pechochar(CHECK_GET(), ch.Get())); }
+
 } // namespace curses
@@ -22,6 +22,9 @@
 #ifndef CURSES_CPP_CURSES_HPP_
 #define CURSES_CPP_CURSES_HPP_
 
+#include "curses_cpp/format.hpp"
+
+#include <array>
 #include <cassert>
 #include <cstdio>
 #include <optional>
@@ -199,6 +202,10 @@ constexpr Chtype operator^(Attr attr, Chtype ch) { return ch ^ attr; }
 constexpr Chtype& operator|=(Chtype& ch, Attr attr) { return ch = ch | attr; }
 constexpr Chtype& operator^=(Chtype& ch, Attr attr) { return ch = ch ^ attr; }
 
+// Write Chtype{c, attr} for each c in text to out, which must have room for
+// text.size() elements. Uses SIMD where available.
+void PackChtype(std::string_view text, Attr attr, Chtype* out);
+
 struct PosYx
 {
     int y = 0;
@@ -252,6 +259,23 @@ constexpr bool operator!=(ScrregTopBot a, ScrregTopBot b)
     return !(a == b);
 }
 
+// Rectangle with inclusive corners
+struct RectMinMax
+{
+    PosYx min{};
+    PosYx max{};
+};
+
+constexpr bool operator==(RectMinMax a, RectMinMax b)
+{
+    return a.min == b.min && a.max == b.max;
+}
+
+constexpr bool operator!=(RectMinMax a, RectMinMax b)
+{
+    return !(a == b);
+}
+
 struct ColorPairFgBg
 {
     Color fg = Color::Black;
@@ -364,6 +388,12 @@ Result Typeahead(int fd);
 
 Result Meta(bool enable = true);
 
+// Milliseconds to wait after Escape for the rest of an escape sequence,
+// which is also the delay before a lone Escape is returned. Default 1000,
+// or the ESCDELAY environment variable. See EscdelayTuner.
+Result SetEscdelay(int ms);
+int GetEscdelay();
+
 // curs_util
 
 void Filter();
@@ -379,6 +409,7 @@ std::string Unctrl(Chtype ch);
 std::string Keyname(int key);
 
 class Window;
+struct WindowSnapshot;
 
 Result Putwin(Window& win, FILE* file);
 std::optional<Window> Getwin(FILE* file);
@@ -448,6 +479,25 @@ Result Flash();
 std::string CursesVersion();
 bool UseExtendendNames(bool enable);
 
+// resizeterm
+
+bool IsTermResized(SizeLinesCols lines_cols);
+Result Resizeterm(SizeLinesCols lines_cols);
+
+// Resize to the current size of the terminal, as reported by the system
+Result Resizeterm();
+
+// define_key, key_defined, keybound
+
+// Make Getch return keycode when definition is read. A null definition
+// removes all definitions of keycode, and a keycode of 0 removes definition.
+Result DefineKey(const char* definition, int keycode);
+// Key code of definition, 0 if it isn't defined, or -1 if it is a prefix of
+// another definition
+int KeyDefined(const char* definition);
+// The count-th definition of keycode, or nullopt
+std::optional<std::string> Keybound(int keycode, int count = 0);
+
 class Window
 {
 public:
@@ -465,7 +515,7 @@ public:
     bool IsEmpty() const { return window_ == nullptr; }
     explicit operator bool() const { return !IsEmpty(); }
 
-    WINDOW* Release() { auto* ret = window_; window_ = nullptr; parent_ = nullptr; return ret; }
+    WINDOW* Release() { auto* ret = window_; window_ = nullptr; parent_ = nullptr; damage_ = {}; return ret; }
 
     const WINDOW* Get() const { return window_; }
     WINDOW* Get() { return window_; }
@@ -481,6 +531,13 @@ public:
     Result Mvwin(PosYx top_left);
     Result Mvderwin(PosYx viewed_top_left);
 
+    // wresize
+
+    // Cells within both the old and the new size keep their contents. Newly
+    // exposed cells are blank and damaged, if damage tracking is enabled.
+    // Subwindows that no longer fit are shrunk by ncurses.
+    Result Resize(SizeLinesCols lines_cols);
+
     Result Syncok(bool enable = true);
     void Syncup();
     void Cursyncup();
@@ -601,11 +658,25 @@ public:
     int Getch();
     int Getch(PosYx yx);
 
+    // Read all pending keys into keys, which has room for cap keys, without
+    // waiting. The window's delay mode is restored afterwards. Return the
+    // number of keys read. With mouse_events, the event for each Key::Mouse
+    // in keys[i] is read with Getmouse into mouse_events[i].
+    int GetchBatch(int* keys, int cap);
+    int GetchBatch(int* keys, Mevent* mouse_events, int cap);
+
     // curs_getstr
+    //
+    // Getstr blocks until Enter. See LineEditor for a non-blocking editor.
 
     std::string Getstr(int maxlen = 1024);
     std::string Getstr(PosYx yx, int maxlen = 1024);
 
+    // Read into buf, which has room for cap characters including the
+    // trailing null. Return the number of characters read, or 0 on error.
+    int Getstr(char* buf, int cap);
+    int Getstr(PosYx yx, char* buf, int cap);
+
     // curs_addch
 
     Result Addch(Chtype ch);
@@ -622,6 +693,24 @@ public:
     Result Addstr(std::string_view str);
     Result Addstr(PosYx yx, std::string_view str);
 
+    // Draw str with attr using PackChtype and Addchstr. Unlike the overloads
+    // above, the string doesn't wrap, control characters are not
+    // interpreted, the window attributes are not applied and the cursor is
+    // left at the start of the string.
+    Result Addstr(std::string_view str, Attr attr);
+    Result Addstr(PosYx yx, std::string_view str, Attr attr);
+
+    // Formatted output, replacing curs_printw. See FormatString for the
+    // syntax. The output is formatted into a stack buffer and truncated to
+    // PrintBufferSize characters.
+
+    static constexpr int PrintBufferSize = 512;
+
+    template<typename... Args>
+    Result Print(const FormatString<detail::TypeIdentity<Args>...>& fmt, const Args&... args);
+    template<typename... Args>
+    Result Print(PosYx yx, const FormatString<detail::TypeIdentity<Args>...>& fmt, const Args&... args);
+
     // curs_insch
 
     Result Insch(Chtype ch);
@@ -647,11 +736,21 @@ public:
     std::basic_string<Chtype> Inchstr(int maxlen = 1024);
     std::basic_string<Chtype> Inchstr(PosYx yx, int maxlen = 1024);
 
+    // Read into buf, which has room for cap elements including the trailing
+    // null. Return the number of elements read, or 0 on error.
+    int Inchstr(Chtype* buf, int cap);
+    int Inchstr(PosYx yx, Chtype* buf, int cap);
+
     // curs_instr
 
     std::string Instr(int maxlen = 1024);
     std::string Instr(PosYx yx, int maxlen = 1024);
 
+    // Read into buf, which has room for cap characters including the
+    // trailing null. Return the number of characters read, or 0 on error.
+    int Instr(char* buf, int cap);
+    int Instr(PosYx yx, char* buf, int cap);
+
     // curs_scroll
 
     Result Scroll(int n = 1);
@@ -668,16 +767,87 @@ public:
     PosYx TransformToWindow(PosYx pos_on_screen) const;
     PosYx TransformToScreen(PosYx pos_in_window) const;
 
+    // Snapshot (see window_snapshot.hpp)
+
+    // Copy the contents and the cursor position to snapshot, reusing its
+    // buffer if it has the right size.
+    void Snapshot(WindowSnapshot& snapshot);
+    WindowSnapshot Snapshot();
+
+    // Draw the contents of snapshot, clipped to the window, and restore the
+    // cursor position.
+    Result Restore(const WindowSnapshot& snapshot);
+
+    // Damage tracking
+    //
+    // When enabled, the output functions (Addch, Addstr, Addchstr, Insch,
+    // Insstr, Delch, Chgat, Hline, Vline, Border, Erase, Clear, Clrto*,
+    // Scroll, Deleteln, Insertln, Overlay, Overwrite, Bkgd and Touch*)
+    // record the bounding rectangle of the cells they may have changed.
+    // Changes made through other Window objects, e.g. a subwindow, are not
+    // recorded.
+
+    void TrackDamage(bool enable = true);
+    bool IsTrackingDamage() const { return damage_.enabled; }
+    std::optional<RectMinMax> GetDamage() const;
+    void ClearDamage() { damage_.damaged = false; }
+
+    // If damaged, call Noutrefresh and, if it succeeds, clear the damage.
+    // Otherwise do nothing and return Ok. Call GetDamage first to get the
+    // rectangle that is flushed.
+    Result FlushDamage();
+
 private:
     friend std::optional<Window> Getwin(FILE* file);
+    friend class Pad;
+
+    struct DamageState
+    {
+        bool enabled = false;
+        bool damaged = false;
+        RectMinMax rect{};
+    };
 
     Window SubwinImpl(
             SizeLinesCols lines_cols,
             PosYx top_left,
             const std::string& method); // subwin, derwin, subpad
 
+    void Damage(RectMinMax rect);
+    void DamageRows(int first, int last);
+    void DamageAll();
+    void DamageToEol(PosYx yx);
+    void DamageSpan(PosYx begin, int n);
+    void DamageVline(PosYx begin, int n);
+    void DamageInsstr(PosYx begin, std::string_view str);
+    void DamageCursorMoved(PosYx before, bool failed);
+
     WINDOW* window_ = nullptr;
     Window* parent_ = nullptr;
+    DamageState damage_{};
+};
+
+// Pad is a Window that is not associated with a part of the screen. It can
+// be larger than the screen, and a part of it is shown with Prefresh or
+// Pnoutrefresh instead of Refresh or Noutrefresh.
+class Pad : public Window
+{
+public:
+    Pad() = default;
+
+    explicit Pad(SizeLinesCols lines_cols);
+
+    // curs_pad
+
+    Pad Subpad(SizeLinesCols lines_cols, PosYx top_left_in_parent);
+
+    Result Prefresh(PosYx pad_min, PosYx screen_min, PosYx screen_max);
+    Result Pnoutrefresh(PosYx pad_min, PosYx screen_min, PosYx screen_max);
+
+    Result Pechochar(Chtype ch);
+
+private:
+    explicit Pad(Window&& window) : Window{std::move(window)} {}
 };
 
 // Window implementation
@@ -687,14 +857,17 @@ inline void swap(Window& a, Window& b)
     using std::swap;
     swap(a.window_, b.window_);
     swap(a.parent_, b.parent_);
+    swap(a.damage_, b.damage_);
 }
 
 inline Window::Window(Window&& other) noexcept :
     window_{other.window_},
-    parent_{other.parent_}
+    parent_{other.parent_},
+    damage_{other.damage_}
 {
     other.window_ = nullptr;
     other.parent_ = nullptr;
+    other.damage_ = {};
 }
 
 inline Window& Window::operator=(Window&& other) noexcept
@@ -704,6 +877,22 @@ inline Window& Window::operator=(Window&& other) noexcept
     return *this;
 }
 
+template<typename... Args>
+Result Window::Print(const FormatString<detail::TypeIdentity<Args>...>& fmt, const Args&... args)
+{
+    std::array<char, PrintBufferSize> buf; // NOLINT: No need to initialize
+    const auto n = FormatTo<Args...>(buf.data(), PrintBufferSize, fmt, args...);
+    return Addstr(std::string_view{buf.data(), static_cast<std::size_t>(n)});
+}
+
+template<typename... Args>
+Result Window::Print(PosYx yx, const FormatString<detail::TypeIdentity<Args>...>& fmt, const Args&... args)
+{
+    std::array<char, PrintBufferSize> buf; // NOLINT: No need to initialize
+    const auto n = FormatTo<Args...>(buf.data(), PrintBufferSize, fmt, args...);
+    return Addstr(yx, std::string_view{buf.data(), static_cast<std::size_t>(n)});
+}
+
 namespace Key
 {
 
@@ -927,4 +1116,8 @@ enum class Mmask : unsigned
 
 } // namespace curses
 
+#if defined(CURSES_CPP_INLINE)
+#include "curses_cpp/curses_inline.hpp"
+#endif
+
 #endif // Include guard
@@ -0,0 +1,153 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_CURSES_INLINE_HPP_
+#define CURSES_CPP_CURSES_INLINE_HPP_
+
+// Definitions of the Window wrappers that are typically called per cell in
+// rendering loops. Normally they are compiled into the library by
+// curses.cpp. With CURSES_CPP_INLINE defined (see the CMake option of the
+// same name) curses.hpp includes this file, so that the wrappers are inline
+// and calls compile down to the ncurses call.
+//
+// Note that in that mode <curses.h> is included by curses.hpp. Its pseudo
+// function macros (clear, move, refresh, ...) are suppressed with
+// NCURSES_NOMACROS, but the constants (OK, ERR, KEY_*, A_*, ...) are not.
+
+#include "curses_cpp/curses.hpp"
+
+#if defined(CURSES_CPP_INLINE) && !defined(NCURSES_NOMACROS)
+#define NCURSES_NOMACROS
+#endif
+#include <curses.h>
+
+#include <cassert>
+#include <limits>
+#include <string_view>
+
+#if defined(CURSES_CPP_INLINE)
+#define CURSES_CPP_HOT inline
+#else
+#define CURSES_CPP_HOT
+#endif
+
+namespace curses
+{
+
+CURSES_CPP_HOT Result Window::Attron(Attr attr)
+{
+    auto* window = Get();
+    assert(window);
+    return static_cast<Result>(wattron(window, static_cast<int>(attr)));
+}
+
+CURSES_CPP_HOT Result Window::Attroff(Attr attr)
+{
+    auto* window = Get();
+    assert(window);
+    return static_cast<Result>(wattroff(window, static_cast<int>(attr)));
+}
+
+CURSES_CPP_HOT Result Window::Attrset(Attr attr)
+{
+    auto* window = Get();
+    assert(window);
+    return static_cast<Result>(wattrset(window, static_cast<int>(attr)));
+}
+
+CURSES_CPP_HOT Result Window::Move(PosYx yx)
+{
+    auto* window = Get();
+    assert(window);
+    return static_cast<Result>(wmove(window, yx.y, yx.x));
+}
+
+CURSES_CPP_HOT PosYx Window::Getyx()
+{
+    auto* window = Get();
+    assert(window);
+    auto ret = PosYx{};
+    getyx(window, ret.y, ret.x);
+    return ret;
+}
+
+CURSES_CPP_HOT Result Window::Addch(Chtype ch)
+{
+    auto* window = Get();
+    assert(window);
+    if (!damage_.enabled) return static_cast<Result>(waddch(window, ch.Get()));
+    const auto before = Getyx();
+    const auto res = waddch(window, ch.Get());
+    DamageCursorMoved(before, res == ERR);
+    return static_cast<Result>(res);
+}
+
+CURSES_CPP_HOT Result Window::Addch(PosYx yx, Chtype ch)
+{
+    auto* window = Get();
+    assert(window);
+    if (!damage_.enabled) return static_cast<Result>(mvwaddch(window, yx.y, yx.x, ch.Get()));
+    const auto res = mvwaddch(window, yx.y, yx.x, ch.Get());
+    DamageCursorMoved(yx, res == ERR);
+    return static_cast<Result>(res);
+}
+
+CURSES_CPP_HOT Result Window::Addchstr(std::basic_string_view<Chtype> str)
+{
+    static_assert(sizeof(Chtype) == sizeof(chtype), "no padding in Chtype");
+    auto* window = Get();
+    assert(window);
+    assert(str.size() <= std::numeric_limits<int>::max());
+    const auto n = static_cast<int>(str.size());
+    if (damage_.enabled) DamageSpan(Getyx(), n);
+    return static_cast<Result>(waddchnstr(window, reinterpret_cast<const chtype*>(str.data()), n));
+}
+
+CURSES_CPP_HOT Result Window::Addchstr(PosYx yx, std::basic_string_view<Chtype> str)
+{
+    static_assert(sizeof(Chtype) == sizeof(chtype), "no padding in Chtype");
+    auto* window = Get();
+    assert(window);
+    assert(str.size() <= std::numeric_limits<int>::max());
+    const auto n = static_cast<int>(str.size());
+    if (damage_.enabled) DamageSpan(yx, n);
+    return static_cast<Result>(mvwaddchnstr(window, yx.y, yx.x, reinterpret_cast<const chtype*>(str.data()), n));
+}
+
+CURSES_CPP_HOT Chtype Window::Inch()
+{
+    auto* window = Get();
+    assert(window);
+    return Chtype{winch(window)};
+}
+
+CURSES_CPP_HOT Chtype Window::Inch(PosYx yx)
+{
+    auto* window = Get();
+    assert(window);
+    return Chtype{mvwinch(window, yx.y, yx.x)};
+}
+
+} // namespace curses
+
+#undef CURSES_CPP_HOT
+
+#endif // Include guard
@@ -0,0 +1,127 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/diff_canvas.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace curses
+{
+
+namespace
+{
+
+// Changed runs separated by fewer clean cells than this are drawn with a
+// single Addchstr. Redrawing a few clean cells is cheaper than the extra
+// call and cursor movement.
+constexpr int MergeGap = 4;
+
+// Return the first index in [i, n) where a and b differ, or n.
+int FindMismatch(const Chtype* a, const Chtype* b, int i, int n)
+{
+#if defined(__SSE2__)
+    static_assert(sizeof(Chtype) == 4);
+    for (; i + 4 <= n; i += 4)
+    {
+        const auto va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        const auto vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+        const auto eq = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi32(va, vb)));
+        if (eq != 0xFFFFU) return i + __builtin_ctz(~eq) / 4;
+    }
+#endif
+    for (; i < n && a[i] == b[i]; ++i) {}
+    return i;
+}
+
+// Return the first index in [i, n) where a and b are equal, or n.
+int FindMatch(const Chtype* a, const Chtype* b, int i, int n)
+{
+    for (; i < n && a[i] != b[i]; ++i) {}
+    return i;
+}
+
+} // namespace
+
+DiffCanvas::DiffCanvas(SizeLinesCols lines_cols, Chtype fill)
+{
+    Resize(lines_cols, fill);
+}
+
+void DiffCanvas::Resize(SizeLinesCols lines_cols, Chtype fill)
+{
+    back_.Resize(lines_cols, fill);
+    front_.Resize(lines_cols, fill);
+    Invalidate();
+}
+
+void DiffCanvas::Invalidate()
+{
+    // Cells are never Chtype{0} (see CellGrid), so every cell will differ
+    front_.Fill(Chtype{0U});
+}
+
+Result DiffCanvas::Commit(Window& window, PosYx top_left)
+{
+    stats_ = {};
+    const auto window_lines = window.Getmaxyx().y;
+    const auto cols = back_.GetCols();
+    const auto y0 = std::max(-top_left.y, 0);
+    const auto y1 = std::min(back_.GetLines(), window_lines - top_left.y);
+    const auto row_bytes = static_cast<std::size_t>(cols) * sizeof(Chtype);
+
+    auto ret = Result::Ok;
+    for (int y = y0; y < y1; ++y)
+    {
+        const auto* back = back_.Row(y);
+        auto* front = front_.Row(y);
+        if (std::memcmp(back, front, row_bytes) == 0) continue;
+
+        ++stats_.changed_rows;
+        auto begin = FindMismatch(back, front, 0, cols);
+        while (begin < cols)
+        {
+            auto end = FindMatch(back, front, begin, cols);
+            auto next = FindMismatch(back, front, end, cols);
+            while (next < cols && next - end < MergeGap)
+            {
+                end = FindMatch(back, front, next, cols);
+                next = FindMismatch(back, front, end, cols);
+            }
+            const auto run = std::basic_string_view<Chtype>{back + begin, static_cast<std::size_t>(end - begin)};
+            if (window.Addchstr({top_left.y + y, top_left.x + begin}, run) == Result::Err)
+            {
+                ret = Result::Err;
+            }
+            ++stats_.runs;
+            stats_.cells += end - begin;
+            begin = next;
+        }
+        std::copy_n(back, cols, front);
+    }
+    return ret;
+}
+
+} // namespace curses
@@ -0,0 +1,79 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_DIFF_CANVAS_HPP_
+#define CURSES_CPP_DIFF_CANVAS_HPP_
+
+#include "curses_cpp/cell_grid.hpp"
+#include "curses_cpp/curses.hpp"
+
+namespace curses
+{
+
+// DiffCanvas is a double-buffered CellGrid. Drawing goes to the back
+// buffer, and Commit compares it with the previously committed frame and
+// draws only the horizontal runs of cells that changed.
+//
+// The canvas assumes that it is the only writer to the part of the window
+// it covers. If that part is modified by other means, call Invalidate.
+class DiffCanvas
+{
+public:
+    struct Stats
+    {
+        int changed_rows = 0;
+        int runs = 0;           // Number of calls to Addchstr
+        int cells = 0;          // Number of cells drawn
+    };
+
+    DiffCanvas() = default;
+    explicit DiffCanvas(SizeLinesCols lines_cols, Chtype fill = ' ');
+
+    SizeLinesCols GetSize() const { return back_.GetSize(); }
+
+    CellGrid& Back() { return back_; }
+    const CellGrid& Back() const { return back_; }
+    const CellGrid& Front() const { return front_; }
+
+    // Resize both buffers, discarding the contents
+    void Resize(SizeLinesCols lines_cols, Chtype fill = ' ');
+
+    // Make the next Commit draw every cell
+    void Invalidate();
+
+    // Draw the changed cells of the back buffer in window, with the top-left
+    // cell at top_left, and copy the back buffer to the front buffer. Rows
+    // that did not change are not written, and their touched state is left
+    // as is, since it may hold changes not yet refreshed.
+    Result Commit(Window& window, PosYx top_left = {});
+
+    // Statistics for the latest Commit
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    CellGrid back_;
+    CellGrid front_;
+    Stats stats_{};
+};
+
+} // namespace curses
+
+#endif // Include guard
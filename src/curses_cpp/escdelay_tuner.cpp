@@ -0,0 +1,139 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/escdelay_tuner.hpp"
+
+#include "curses_cpp/keymap.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace curses
+{
+
+namespace
+{
+
+// Gaps shorter than this mean that the keys were read together
+constexpr auto MinGap = std::chrono::milliseconds{1};
+
+bool IsSequenceByte(int key) { return 0x20 <= key && key <= 0x7e; }
+bool IsFinalByte(int key) { return 0x40 <= key && key <= 0x7e; }
+
+} // namespace
+
+EscdelayTuner::EscdelayTuner(
+        int initial_ms,
+        int max_ms,
+        int margin_ms,
+        int min_splits,
+        Clock::duration decay_period,
+        Clock::time_point now) :
+    initial_ms_{initial_ms},
+    escdelay_ms_{initial_ms},
+    max_ms_{max_ms},
+    margin_ms_{margin_ms},
+    min_splits_{min_splits},
+    decay_period_{decay_period},
+    last_change_time_{now}
+{
+    assert(0 <= initial_ms && initial_ms <= max_ms && margin_ms >= 0 && min_splits >= 1);
+    assert(decay_period > Clock::duration::zero());
+    SetEscdelay(escdelay_ms_);
+}
+
+void EscdelayTuner::Observe(int key, Clock::time_point now)
+{
+    Decay(now);
+    const auto gap = now - last_key_time_;
+    last_key_time_ = now;
+    // Bytes further apart than the largest delay are separate keys
+    if (gap > std::chrono::milliseconds{max_ms_}) state_ = State::Idle;
+    switch (state_)
+    {
+    case State::Idle:
+        break;
+    case State::Escape:
+        if (key == '[' || key == 'O')
+        {
+            state_ = State::Sequence;
+            sequence_ += static_cast<char>(key);
+            sequence_gap_ = Clock::duration::zero();
+            ObserveGap(gap);
+            return;
+        }
+        break;
+    case State::Sequence:
+        if (IsSequenceByte(key))
+        {
+            sequence_ += static_cast<char>(key);
+            ObserveGap(gap);
+            if (!IsFinalByte(key)) return;
+            EndSequence(now);
+        }
+        break;
+    }
+    state_ = key == EscapeKey ? State::Escape : State::Idle;
+    if (state_ == State::Escape) sequence_.assign(1, static_cast<char>(EscapeKey));
+}
+
+void EscdelayTuner::ObserveGap(Clock::duration gap)
+{
+    if (gap < MinGap) return;
+    // At the first split, ncurses had waited for the delay to expire before
+    // returning the keys read so far, so the bytes were that much further
+    // apart
+    const auto is_first_split = sequence_gap_ == Clock::duration::zero();
+    sequence_gap_ = std::max(sequence_gap_, is_first_split ? gap + std::chrono::milliseconds{escdelay_ms_} : gap);
+}
+
+void EscdelayTuner::EndSequence(Clock::time_point now)
+{
+    if (sequence_gap_ == Clock::duration::zero() || KeyDefined(sequence_.c_str()) <= 0) return;
+    ++split_sequence_count_;
+    ++recent_split_count_;
+    max_gap_ = std::max(max_gap_, sequence_gap_);
+    last_change_time_ = now;
+    if (recent_split_count_ < min_splits_) return;
+    const auto needed_ms = std::chrono::ceil<std::chrono::milliseconds>(max_gap_).count() + margin_ms_;
+    SetDelay(static_cast<int>(std::min<decltype(needed_ms)>(needed_ms, max_ms_)));
+}
+
+void EscdelayTuner::Decay(Clock::time_point now)
+{
+    while (now - last_change_time_ >= decay_period_
+            && (escdelay_ms_ > initial_ms_ || max_gap_ > Clock::duration::zero() || recent_split_count_ > 0))
+    {
+        last_change_time_ += decay_period_;
+        recent_split_count_ = 0;
+        max_gap_ /= 2;
+        SetDelay(std::max(initial_ms_, (escdelay_ms_ + initial_ms_) / 2));
+    }
+}
+
+void EscdelayTuner::SetDelay(int escdelay_ms)
+{
+    if (escdelay_ms == escdelay_ms_) return;
+    escdelay_ms_ = escdelay_ms;
+    SetEscdelay(escdelay_ms_);
+}
+
+} // namespace curses
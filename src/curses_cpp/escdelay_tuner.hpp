@@ -0,0 +1,104 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_ESCDELAY_TUNER_HPP_
+#define CURSES_CPP_ESCDELAY_TUNER_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <chrono>
+#include <string>
+
+namespace curses
+{
+
+// EscdelayTuner adapts the escape delay (see SetEscdelay) to the
+// connection. It starts with a short delay, so that a lone Escape is
+// returned almost immediately, and raises the delay when escape sequences
+// arrive split, i.e. as separate keys instead of one function key.
+//
+// A split sequence shows up as Escape followed by '[' or 'O' and then
+// parameter and final bytes. It only counts if KeyDefined recognizes the
+// bytes as a key, and if the keys were neither read together (less than
+// 1 ms apart) nor more than max_ms apart, since a person typing Escape, '['
+// and a letter gives the same keys. The time between the keys, plus the
+// delay that expired at the first split, gives the inter-byte gaps of the
+// link.
+//
+// After min_splits split sequences, the delay is set to the largest gap
+// observed plus margin_ms, at most max_ms. Each decay_period without a
+// split, the count of split sequences is reset, and the delay and the
+// largest gap move halfway back to initial_ms, so that an occasional stall
+// on the link doesn't slow down Escape for good.
+//
+// Pass every key read from Getch to Observe. Keypad must be enabled.
+class EscdelayTuner
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Set the escape delay to initial_ms
+    explicit EscdelayTuner(
+            int initial_ms = 25,
+            int max_ms = 1000,
+            int margin_ms = 10,
+            int min_splits = 2,
+            Clock::duration decay_period = std::chrono::seconds{30},
+            Clock::time_point now = Clock::now());
+
+    void Observe(int key, Clock::time_point now = Clock::now());
+
+    int GetEscdelay() const { return escdelay_ms_; }
+    Clock::duration GetMaxGap() const { return max_gap_; }
+    long GetSplitSequenceCount() const { return split_sequence_count_; }
+
+private:
+    enum class State
+    {
+        Idle,
+        Escape,    // Read Escape
+        Sequence,  // Read Escape and '[' or 'O'
+    };
+
+    void ObserveGap(Clock::duration gap);
+    void EndSequence(Clock::time_point now);
+    void Decay(Clock::time_point now);
+    void SetDelay(int escdelay_ms);
+
+    int initial_ms_;
+    int escdelay_ms_;
+    int max_ms_;
+    int margin_ms_;
+    int min_splits_;
+    Clock::duration decay_period_;
+    State state_ = State::Idle;
+    std::string sequence_;             // Bytes of the current sequence
+    Clock::duration sequence_gap_{};   // Largest gap in the current sequence
+    Clock::time_point last_key_time_{};
+    Clock::time_point last_change_time_;
+    Clock::duration max_gap_{};
+    long split_sequence_count_ = 0;
+    int recent_split_count_ = 0;       // Since the last decay
+};
+
+} // namespace curses
+
+#endif // Include guard
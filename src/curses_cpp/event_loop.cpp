@@ -0,0 +1,246 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/event_loop.hpp"
+
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/ioctl.h>
+#include <sys/signalfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace curses
+{
+
+namespace
+{
+
+Result AddToEpoll(int epoll_fd, int fd)
+{
+    auto event = epoll_event{};
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0 ? Result::Ok : Result::Err;
+}
+
+} // namespace
+
+EventLoop::EventLoop(Window& window, int input_fd) :
+    window_{&window},
+    input_fd_{input_fd}
+{
+    auto sigwinch = sigset_t{};
+    sigemptyset(&sigwinch);
+    sigaddset(&sigwinch, SIGWINCH);
+    auto old_mask = sigset_t{};
+    pthread_sigmask(SIG_BLOCK, &sigwinch, &old_mask);
+    unblock_sigwinch_ = !sigismember(&old_mask, SIGWINCH);
+
+    epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+    timer_fd_ = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    signal_fd_ = signalfd(-1, &sigwinch, SFD_NONBLOCK | SFD_CLOEXEC);
+    const auto ok =
+            epoll_fd_ != -1 && timer_fd_ != -1 && signal_fd_ != -1 &&
+            AddToEpoll(epoll_fd_, input_fd_) == Result::Ok &&
+            AddToEpoll(epoll_fd_, timer_fd_) == Result::Ok &&
+            AddToEpoll(epoll_fd_, signal_fd_) == Result::Ok;
+    if (!ok)
+    {
+        Close();
+        throw std::runtime_error{"EventLoop setup failed"};
+    }
+}
+
+EventLoop::~EventLoop()
+{
+    Close();
+}
+
+void EventLoop::Close()
+{
+    for (auto* fd : {&epoll_fd_, &timer_fd_, &signal_fd_})
+    {
+        if (*fd != -1) close(*fd);
+        *fd = -1;
+    }
+    if (unblock_sigwinch_)
+    {
+        // A SIGWINCH that arrived in the meantime goes to the ncurses handler
+        auto sigwinch = sigset_t{};
+        sigemptyset(&sigwinch);
+        sigaddset(&sigwinch, SIGWINCH);
+        pthread_sigmask(SIG_UNBLOCK, &sigwinch, nullptr);
+        unblock_sigwinch_ = false;
+    }
+}
+
+Result EventLoop::AddFd(int fd, FdHandler handler)
+{
+    assert(handler);
+    if (AddToEpoll(epoll_fd_, fd) != Result::Ok) return Result::Err;
+    fds_.push_back({fd, std::move(handler)});
+    return Result::Ok;
+}
+
+Result EventLoop::RemoveFd(int fd)
+{
+    const auto it = std::find_if(fds_.begin(), fds_.end(), [&] (const FdEntry& entry) { return entry.fd == fd; });
+    if (it == fds_.end()) return Result::Err;
+    fds_.erase(it);
+    return epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr) == 0 ? Result::Ok : Result::Err;
+}
+
+EventLoop::TimerId EventLoop::AddTimer(Clock::duration delay, TimerHandler handler, Clock::duration period)
+{
+    assert(handler);
+    const auto id = next_timer_id_++;
+    timers_.push_back({id, Clock::now() + delay, period, std::move(handler)});
+    ArmTimer();
+    return id;
+}
+
+void EventLoop::CancelTimer(TimerId id)
+{
+    const auto it = std::find_if(timers_.begin(), timers_.end(), [&] (const Timer& timer) { return timer.id == id; });
+    if (it == timers_.end()) return;
+    timers_.erase(it);
+    ArmTimer();
+}
+
+Result EventLoop::RunOnce(int timeout_ms)
+{
+    auto events = std::array<epoll_event, 16>{};
+    const auto n = epoll_wait(epoll_fd_, events.data(), static_cast<int>(events.size()), timeout_ms);
+    if (n == -1) return errno == EINTR ? Result::Ok : Result::Err;
+    for (int i = 0; i < n; ++i)
+    {
+        const auto fd = events[i].data.fd;
+        if (fd == input_fd_) PollInput();
+        else if (fd == timer_fd_) RunTimers();
+        else if (fd == signal_fd_) HandleSignal();
+        else
+        {
+            const auto it = std::find_if(fds_.begin(), fds_.end(), [&] (const FdEntry& entry) { return entry.fd == fd; });
+            if (it == fds_.end()) continue;  // Removed by an earlier handler
+            // Copy, since the handler may remove itself
+            const auto handler = it->handler;
+            handler(fd);
+        }
+    }
+    return Result::Ok;
+}
+
+Result EventLoop::Run()
+{
+    running_ = true;
+    while (running_)
+    {
+        if (RunOnce() != Result::Ok) return Result::Err;
+    }
+    return Result::Ok;
+}
+
+void EventLoop::PollInput()
+{
+    auto keys = std::array<int, 64>{};
+    auto mouse_events = std::array<Mevent, 64>{};
+    auto n = 0;
+    do
+    {
+        n = window_->GetchBatch(keys.data(), mouse_events.data(), static_cast<int>(keys.size()));
+        const auto num_events = coalesce_mouse_motion_ ? mouse_coalescer_.Coalesce(keys.data(), mouse_events.data(), n) : n;
+        for (int i = 0; i < num_events; ++i)
+        {
+            if (keys[i] == Key::Mouse && mouse_handler_) mouse_handler_(mouse_events[i]);
+            else if (key_handler_) key_handler_(keys[i]);
+        }
+    } while (n == static_cast<int>(keys.size()));
+}
+
+void EventLoop::RunTimers()
+{
+    auto expirations = std::uint64_t{};
+    [[maybe_unused]]
+    const auto res = read(timer_fd_, &expirations, sizeof(expirations));
+    const auto now = Clock::now();
+    while (true)
+    {
+        const auto it = std::min_element(
+                timers_.begin(), timers_.end(),
+                [] (const Timer& a, const Timer& b) { return a.deadline < b.deadline; });
+        if (it == timers_.end() || it->deadline > now) break;
+        // Copy, since the handler may add or cancel timers
+        const auto handler = it->handler;
+        if (it->period > Clock::duration::zero())
+        {
+            it->deadline = std::max(it->deadline + it->period, now + Clock::duration{1});
+        }
+        else
+        {
+            timers_.erase(it);
+        }
+        handler();
+    }
+    ArmTimer();
+}
+
+void EventLoop::ArmTimer()
+{
+    auto spec = itimerspec{};
+    const auto it = std::min_element(
+            timers_.begin(), timers_.end(),
+            [] (const Timer& a, const Timer& b) { return a.deadline < b.deadline; });
+    if (it != timers_.end())
+    {
+        // Zero disarms the timer, so wait at least 1 ns
+        const auto delay = std::max(it->deadline - Clock::now(), Clock::duration{1});
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(delay).count();
+        spec.it_value.tv_sec = static_cast<time_t>(ns / 1'000'000'000);
+        spec.it_value.tv_nsec = static_cast<long>(ns % 1'000'000'000);
+    }
+    timerfd_settime(timer_fd_, 0, &spec, nullptr);
+}
+
+void EventLoop::HandleSignal()
+{
+    auto info = signalfd_siginfo{};
+    while (read(signal_fd_, &info, sizeof(info)) == static_cast<ssize_t>(sizeof(info))) {}
+    // Resizeterm pushes Key::Resize to the input queue even if the size is
+    // the same, so only call it if the size changed
+    auto size = winsize{};
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && size.ws_row != 0 && size.ws_col != 0
+            && IsTermResized({size.ws_row, size.ws_col}))
+    {
+        Resizeterm({size.ws_row, size.ws_col});
+    }
+    PollInput();
+}
+
+} // namespace curses
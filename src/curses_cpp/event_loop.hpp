@@ -0,0 +1,135 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_EVENT_LOOP_HPP_
+#define CURSES_CPP_EVENT_LOOP_HPP_
+
+#include "curses_cpp/curses.hpp"
+#include "curses_cpp/mouse_coalescer.hpp"
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace curses
+{
+
+// EventLoop waits for keyboard and mouse input, terminal resizes, timers and
+// user file descriptors at the same time, without polling. It uses epoll
+// and is only available on Linux.
+//
+// When the input is readable, all pending keys are read with
+// Window::GetchBatch and dispatched. Key::Mouse is dispatched to the mouse
+// handler with the event from Getmouse, if there is a mouse handler.
+// SIGWINCH is blocked and received with a signalfd. If the terminal size
+// changed, it is handled by calling Resizeterm, which makes ncurses return
+// Key::Resize from Getch. The signal is only blocked in the thread that
+// creates the loop, so other threads should block it too, or a SIGWINCH
+// delivered to them goes to the ncurses handler instead.
+//
+// Handlers are called on the thread that runs the loop, and may add and
+// remove file descriptors and timers and call Stop.
+class EventLoop
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using KeyHandler = std::function<void(int key)>;
+    using MouseHandler = std::function<void(const Mevent& event)>;
+    using FdHandler = std::function<void(int fd)>;
+    using TimerHandler = std::function<void()>;
+    using TimerId = int;
+
+    // Read input with window, which must outlive the loop. Throws
+    // std::runtime_error if the epoll, timer or signal descriptors can't be
+    // created.
+    explicit EventLoop(Window& window, int input_fd = 0);
+
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    ~EventLoop();
+
+    void OnKey(KeyHandler handler) { key_handler_ = std::move(handler); }
+    void OnMouse(MouseHandler handler) { mouse_handler_ = std::move(handler); }
+
+    // Merge runs of mouse motion events in each batch of input, see
+    // MouseCoalescer
+    void SetCoalesceMouseMotion(bool enable) { coalesce_mouse_motion_ = enable; }
+    const MouseCoalescer& GetMouseCoalescer() const { return mouse_coalescer_; }
+
+    // Call handler when fd is readable. The caller keeps ownership of fd.
+    Result AddFd(int fd, FdHandler handler);
+    Result RemoveFd(int fd);
+
+    // Call handler after delay, and then every period if period is nonzero
+    TimerId AddTimer(Clock::duration delay, TimerHandler handler, Clock::duration period = {});
+    void CancelTimer(TimerId id);
+
+    // Wait up to timeout_ms (-1 for no limit) and dispatch the events
+    Result RunOnce(int timeout_ms = -1);
+
+    // Dispatch events until Stop is called
+    Result Run();
+    void Stop() { running_ = false; }
+
+    // Read and dispatch pending keys without waiting, e.g. after Ungetch,
+    // since keys pushed back into ncurses don't make the input readable
+    void PollInput();
+
+private:
+    struct FdEntry
+    {
+        int fd;
+        FdHandler handler;
+    };
+
+    struct Timer
+    {
+        TimerId id;
+        Clock::time_point deadline;
+        Clock::duration period;
+        TimerHandler handler;
+    };
+
+    void Close();
+    void RunTimers();
+    void ArmTimer();
+    void HandleSignal();
+
+    Window* window_;
+    int input_fd_;
+    int epoll_fd_ = -1;
+    int timer_fd_ = -1;
+    int signal_fd_ = -1;
+    bool unblock_sigwinch_ = false;
+    bool running_ = false;
+    bool coalesce_mouse_motion_ = false;
+    MouseCoalescer mouse_coalescer_;
+    KeyHandler key_handler_;
+    MouseHandler mouse_handler_;
+    std::vector<FdEntry> fds_;
+    std::vector<Timer> timers_;
+    TimerId next_timer_id_ = 0;
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,197 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/format.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+
+namespace curses
+{
+
+namespace detail
+{
+
+namespace
+{
+
+// Output buffer that silently truncates
+class Output
+{
+public:
+    Output(char* buf, int cap) : buf_{buf}, cap_{std::max(cap, 0)} {}
+
+    void Put(std::string_view str)
+    {
+        const auto n = std::min(static_cast<int>(str.size()), cap_ - size_);
+        std::memcpy(buf_ + size_, str.data(), n);
+        size_ += n;
+    }
+
+    void Put(char c, int count)
+    {
+        const auto n = std::min(count, cap_ - size_);
+        if (n <= 0) return;
+        std::memset(buf_ + size_, c, n);
+        size_ += n;
+    }
+
+    int Size() const { return size_; }
+
+private:
+    char* buf_;
+    int cap_;
+    int size_ = 0;
+};
+
+int Base(char type)
+{
+    switch (type)
+    {
+    case 'x': case 'X': return 16;
+    case 'o': return 8;
+    case 'b': return 2;
+    default: return 10;
+    }
+}
+
+// Convert a number to text in tmp, return the text (without sign) and set
+// negative
+template<std::size_t N>
+std::string_view ConvertNumber(std::array<char, N>& tmp, const FormatArg& arg, const FormatSpec& spec, bool& negative)
+{
+    auto* first = tmp.data();
+    auto* last = tmp.data() + tmp.size();
+    auto res = std::to_chars_result{first, std::errc{}};
+    negative = false;
+    switch (arg.kind)
+    {
+    case FormatArgKind::Int:
+        negative = arg.i < 0;
+        // Negate in unsigned arithmetic to handle the minimum value
+        res = std::to_chars(first, last, negative ? 0ULL - static_cast<unsigned long long>(arg.i) : static_cast<unsigned long long>(arg.i), Base(spec.type));
+        break;
+    case FormatArgKind::Uint:
+        res = std::to_chars(first, last, arg.u, Base(spec.type));
+        break;
+    case FormatArgKind::Float:
+    {
+        negative = std::signbit(arg.f);
+        const auto value = negative ? -arg.f : arg.f;
+        const auto format =
+                spec.type == 'e' ? std::chars_format::scientific :
+                spec.type == 'g' ? std::chars_format::general :
+                std::chars_format::fixed;
+        if (spec.precision >= 0) res = std::to_chars(first, last, value, format, spec.precision);
+        else if (spec.type == '\0') res = std::to_chars(first, last, value);
+        else res = std::to_chars(first, last, value, format);
+        break;
+    }
+    default:
+        break;
+    }
+    if (res.ec != std::errc{}) return "?";
+    if (spec.type == 'X') std::transform(first, res.ptr, first, [] (char c) { return ('a' <= c && c <= 'z') ? static_cast<char>(c - 'a' + 'A') : c; });
+    return {first, static_cast<std::size_t>(res.ptr - first)};
+}
+
+void PutPadded(Output& out, std::string_view sign, std::string_view text, const FormatSpec& spec, char default_align)
+{
+    const auto size = static_cast<int>(sign.size() + text.size());
+    const auto padding = std::max(spec.width - size, 0);
+    if (spec.zero_pad && spec.align == '\0' && default_align == '>')
+    {
+        out.Put(sign);
+        out.Put('0', padding);
+        out.Put(text);
+        return;
+    }
+    const auto align = spec.align == '\0' ? default_align : spec.align;
+    const auto before = align == '>' ? padding : align == '^' ? padding / 2 : 0;
+    out.Put(spec.fill, before);
+    out.Put(sign);
+    out.Put(text);
+    out.Put(spec.fill, padding - before);
+}
+
+void PutArg(Output& out, const FormatArg& arg, const FormatSpec& spec)
+{
+    switch (arg.kind)
+    {
+    case FormatArgKind::String:
+    {
+        auto text = arg.s;
+        if (spec.precision >= 0) text = text.substr(0, spec.precision);
+        return PutPadded(out, "", text, spec, '<');
+    }
+    case FormatArgKind::Bool:
+        if (spec.type == '\0' || spec.type == 's')
+        {
+            return PutPadded(out, "", arg.u ? "true" : "false", spec, '<');
+        }
+        break;
+    case FormatArgKind::Char:
+        if (spec.type == '\0' || spec.type == 'c')
+        {
+            const auto c = static_cast<char>(arg.u);
+            return PutPadded(out, "", {&c, 1}, spec, '<');
+        }
+        break;
+    default:
+        if (spec.type == 'c')
+        {
+            const auto c = static_cast<char>(arg.kind == FormatArgKind::Int ? arg.i : static_cast<long long>(arg.u));
+            return PutPadded(out, "", {&c, 1}, spec, '<');
+        }
+        break;
+    }
+    auto tmp = std::array<char, 128>{};
+    auto negative = false;
+    const auto text = ConvertNumber(tmp, arg, spec, negative);
+    PutPadded(out, negative ? "-" : "", text, spec, '>');
+}
+
+} // namespace
+
+int VFormatTo(
+        char* buf,
+        int cap,
+        std::string_view str,
+        const FormatSegment* segments,
+        int num_segments,
+        const FormatArg* args)
+{
+    auto out = Output{buf, cap};
+    for (int i = 0; i < num_segments; ++i)
+    {
+        const auto& segment = segments[i];
+        out.Put(str.substr(segment.literal_begin, segment.literal_size));
+        if (segment.arg >= 0) PutArg(out, args[segment.arg], segment.spec);
+    }
+    return out.Size();
+}
+
+} // namespace detail
+
+} // namespace curses
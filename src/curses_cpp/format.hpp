@@ -0,0 +1,365 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_FORMAT_HPP_
+#define CURSES_CPP_FORMAT_HPP_
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+// FormatString constructors are consteval when available, so that format
+// strings passed directly to Window::Print are parsed and checked at compile
+// time. Before C++20 a string literal is parsed, and an invalid format
+// string throws, each time it is passed; wrap it in CURSES_CPP_FORMAT, or
+// declare the FormatString constexpr, to parse it at compile time.
+#if defined(__cpp_consteval)
+#define CURSES_CPP_CONSTEVAL consteval
+#else
+#define CURSES_CPP_CONSTEVAL constexpr
+#endif
+
+// Format string literal that is parsed and checked at compile time in any
+// language version, for example
+//
+//     window.Print(CURSES_CPP_FORMAT("fps: {:>4}"), fps);
+//
+// The literal is returned by a local type, from which FormatString is
+// constructed via a constexpr variable, which forces constant evaluation.
+#define CURSES_CPP_FORMAT(str) \
+    [] \
+    { \
+        struct CompileString : ::curses::detail::CompileString \
+        { \
+            constexpr std::string_view Get() const { return str; } \
+        }; \
+        return CompileString{}; \
+    }()
+
+namespace curses
+{
+
+template<typename... Args>
+class FormatString;
+
+namespace detail
+{
+
+// Base of the types created by CURSES_CPP_FORMAT
+struct CompileString {};
+
+struct ParseFormatTag {};
+
+// Fmt parsed from the string of S, in a constant expression
+template<typename Fmt, typename S>
+inline constexpr Fmt ParsedFormat = Fmt{ParseFormatTag{}, S{}.Get()};
+
+template<typename T>
+struct TypeIdentityImpl { using Type = T; };
+
+// Prevent template argument deduction, like C++20 std::type_identity_t
+template<typename T>
+using TypeIdentity = typename TypeIdentityImpl<T>::Type;
+
+enum class FormatArgKind
+{
+    Bool,
+    Char,
+    Int,
+    Uint,
+    Float,
+    String,
+};
+
+template<typename T>
+constexpr FormatArgKind GetFormatArgKind()
+{
+    using U = std::remove_cv_t<std::remove_reference_t<T>>;
+    if constexpr (std::is_same_v<U, bool>) return FormatArgKind::Bool;
+    else if constexpr (std::is_same_v<U, char>) return FormatArgKind::Char;
+    else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) return FormatArgKind::Int;
+    else if constexpr (std::is_integral_v<U>) return FormatArgKind::Uint;
+    else if constexpr (std::is_floating_point_v<U>) return FormatArgKind::Float;
+    else
+    {
+        static_assert(std::is_convertible_v<const U&, std::string_view>, "Unsupported format argument type");
+        return FormatArgKind::String;
+    }
+}
+
+struct FormatSpec
+{
+    char fill = ' ';
+    char align = '\0';      // '<', '>', '^' or '\0' for default
+    bool zero_pad = false;
+    int width = 0;
+    int precision = -1;
+    char type = '\0';
+};
+
+// Literal text str[literal_begin, literal_begin + literal_size) followed by
+// argument arg, unless arg is -1
+struct FormatSegment
+{
+    int literal_begin = 0;
+    int literal_size = 0;
+    int arg = -1;
+    FormatSpec spec{};
+};
+
+// Type-erased argument
+struct FormatArg
+{
+    FormatArgKind kind = FormatArgKind::Int;
+    long long i = 0;
+    unsigned long long u = 0;
+    double f = 0;
+    std::string_view s;
+};
+
+template<typename T>
+FormatArg MakeFormatArg(const T& value)
+{
+    auto ret = FormatArg{};
+    ret.kind = GetFormatArgKind<T>();
+    if constexpr (GetFormatArgKind<T>() == FormatArgKind::Bool) ret.u = value ? 1 : 0;
+    else if constexpr (GetFormatArgKind<T>() == FormatArgKind::Char) ret.u = static_cast<unsigned char>(value);
+    else if constexpr (GetFormatArgKind<T>() == FormatArgKind::Int) ret.i = value;
+    else if constexpr (GetFormatArgKind<T>() == FormatArgKind::Uint) ret.u = value;
+    else if constexpr (GetFormatArgKind<T>() == FormatArgKind::Float) ret.f = static_cast<double>(value);
+    else ret.s = std::string_view{value};
+    return ret;
+}
+
+// Write the formatted output to buf, truncated to cap characters, without
+// trailing null. Return the number of characters written.
+int VFormatTo(
+        char* buf,
+        int cap,
+        std::string_view str,
+        const FormatSegment* segments,
+        int num_segments,
+        const FormatArg* args);
+
+constexpr bool IsDigit(char c) { return '0' <= c && c <= '9'; }
+
+constexpr bool IsAlign(char c) { return c == '<' || c == '>' || c == '^'; }
+
+constexpr bool IsTypeAllowed(char type, FormatArgKind kind)
+{
+    switch (type)
+    {
+    case '\0':
+        return true;
+    case 'd': case 'x': case 'X': case 'o': case 'b':
+        return kind == FormatArgKind::Int || kind == FormatArgKind::Uint;
+    case 'f': case 'e': case 'g':
+        return kind == FormatArgKind::Float;
+    case 's':
+        return kind == FormatArgKind::String || kind == FormatArgKind::Bool;
+    case 'c':
+        return kind == FormatArgKind::Char || kind == FormatArgKind::Int || kind == FormatArgKind::Uint;
+    default:
+        return false;
+    }
+}
+
+// Called in case of invalid input to a constexpr parser, such as a format
+// string. Since throw is not allowed in constant expressions, this is a
+// compile-time error when the parser runs at compile time.
+[[noreturn]] inline void ConstexprError(const char* what)
+{
+    throw std::invalid_argument{what};
+}
+
+} // namespace detail
+
+// Format string for Window::Print and FormatTo, with a subset of the
+// std::format syntax:
+//
+//     {[:[[fill]align][0][width][.precision][type]]}
+//
+// where align is one of <>^ and type is one of dxXob (integers), feg
+// (floating point), s (strings and bool) or c (characters). Use {{ and }}
+// for literal braces. Arguments can't be referred to by index.
+//
+// The format string is parsed when the FormatString is constructed, so that
+// formatting only copies literal text and converts the arguments. At most
+// MaxEscapes escaped braces are allowed.
+template<typename... Args>
+class FormatString
+{
+public:
+    template<std::size_t N>
+    CURSES_CPP_CONSTEVAL FormatString(const char (&str)[N]) : // NOLINT: Allow implicit conversion
+        str_{str, N - 1}
+    {
+        Parse();
+    }
+
+    // From CURSES_CPP_FORMAT
+    template<typename S, typename = std::enable_if_t<std::is_base_of_v<detail::CompileString, S>>>
+    constexpr FormatString(S) : // NOLINT: Allow implicit conversion
+        FormatString{detail::ParsedFormat<FormatString, S>}
+    {
+    }
+
+    // Used by ParsedFormat
+    constexpr FormatString(detail::ParseFormatTag, std::string_view str) :
+        str_{str}
+    {
+        Parse();
+    }
+
+    constexpr std::string_view Get() const { return str_; }
+    constexpr int GetNumSegments() const { return num_segments_; }
+    constexpr const detail::FormatSegment* GetSegments() const { return segments_.data(); }
+
+    // Each escaped brace ends a literal segment. The segments are stored in
+    // the FormatString, to keep it a literal type that doesn't allocate, so
+    // their number must be fixed by Args and can't depend on the string. 8
+    // allows for a few literal {} pairs, as in "{{{}}}", which is what
+    // format strings for status lines and the like need; more is a format
+    // error like any other.
+    static constexpr int MaxEscapes = 8;
+
+private:
+    static constexpr int MaxSegments = static_cast<int>(sizeof...(Args)) + 1 + MaxEscapes;
+
+    constexpr void AddSegment(int literal_begin, int literal_end, int arg, detail::FormatSpec spec)
+    {
+        if (num_segments_ == MaxSegments) detail::ConstexprError("Too many escaped braces in format string");
+        auto& segment = segments_[num_segments_++];
+        segment.literal_begin = literal_begin;
+        segment.literal_size = literal_end - literal_begin;
+        segment.arg = arg;
+        segment.spec = spec;
+    }
+
+    constexpr void Parse()
+    {
+        constexpr auto kinds = std::array<detail::FormatArgKind, sizeof...(Args) + 1>{detail::GetFormatArgKind<Args>()...};
+        const auto n = static_cast<int>(str_.size());
+        auto literal_begin = 0;
+        auto num_args = 0;
+        auto i = 0;
+        while (i < n)
+        {
+            const auto c = str_[i];
+            if (c == '}')
+            {
+                if (i + 1 == n || str_[i + 1] != '}') detail::ConstexprError("Unmatched } in format string");
+                AddSegment(literal_begin, i + 1, -1, {});
+                i += 2;
+                literal_begin = i;
+                continue;
+            }
+            if (c != '{')
+            {
+                ++i;
+                continue;
+            }
+            if (i + 1 < n && str_[i + 1] == '{')
+            {
+                AddSegment(literal_begin, i + 1, -1, {});
+                i += 2;
+                literal_begin = i;
+                continue;
+            }
+            const auto literal_end = i;
+            ++i;
+            auto spec = detail::FormatSpec{};
+            if (i < n && str_[i] == ':') i = ParseSpec(i + 1, spec);
+            if (i >= n || str_[i] != '}') detail::ConstexprError("Invalid replacement field in format string");
+            if (num_args == static_cast<int>(sizeof...(Args))) detail::ConstexprError("Too few arguments for format string");
+            if (!detail::IsTypeAllowed(spec.type, kinds[num_args])) detail::ConstexprError("Format type does not match argument");
+            if (spec.precision >= 0 && kinds[num_args] != detail::FormatArgKind::Float && kinds[num_args] != detail::FormatArgKind::String)
+            {
+                detail::ConstexprError("Precision is only allowed for floating point and string arguments");
+            }
+            AddSegment(literal_begin, literal_end, num_args++, spec);
+            ++i;
+            literal_begin = i;
+        }
+        if (num_args != static_cast<int>(sizeof...(Args))) detail::ConstexprError("Too many arguments for format string");
+        AddSegment(literal_begin, n, -1, {});
+    }
+
+    constexpr int ParseSpec(int i, detail::FormatSpec& spec) const
+    {
+        const auto n = static_cast<int>(str_.size());
+        if (i + 1 < n && detail::IsAlign(str_[i + 1]) && str_[i] != '{' && str_[i] != '}')
+        {
+            spec.fill = str_[i];
+            spec.align = str_[i + 1];
+            i += 2;
+        }
+        else if (i < n && detail::IsAlign(str_[i]))
+        {
+            spec.align = str_[i++];
+        }
+        if (i < n && str_[i] == '0')
+        {
+            spec.zero_pad = true;
+            ++i;
+        }
+        i = ParseInt(i, spec.width);
+        if (i < n && str_[i] == '.')
+        {
+            const auto digits_begin = i + 1;
+            spec.precision = 0;
+            i = ParseInt(digits_begin, spec.precision);
+            if (i == digits_begin) detail::ConstexprError("Missing precision in format string");
+        }
+        if (i < n && str_[i] != '}') spec.type = str_[i++];
+        return i;
+    }
+
+    constexpr int ParseInt(int i, int& value) const
+    {
+        const auto n = static_cast<int>(str_.size());
+        for (; i < n && detail::IsDigit(str_[i]); ++i)
+        {
+            value = 10 * value + (str_[i] - '0');
+            if (value > 1000) detail::ConstexprError("Width or precision too large in format string");
+        }
+        return i;
+    }
+
+    std::string_view str_;
+    std::array<detail::FormatSegment, MaxSegments> segments_{};
+    int num_segments_ = 0;
+};
+
+// Write the formatted output to buf, truncated to cap characters, without
+// trailing null. Return the number of characters written. Doesn't allocate.
+template<typename... Args>
+int FormatTo(char* buf, int cap, const FormatString<detail::TypeIdentity<Args>...>& fmt, const Args&... args)
+{
+    const auto erased = std::array<detail::FormatArg, sizeof...(Args) + 1>{detail::MakeFormatArg(args)...};
+    return detail::VFormatTo(buf, cap, fmt.Get(), fmt.GetSegments(), fmt.GetNumSegments(), erased.data());
+}
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,80 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/frame_scheduler.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace curses
+{
+
+FrameScheduler::FrameScheduler(int max_fps) :
+    frame_period_{std::chrono::duration_cast<Clock::duration>(std::chrono::seconds{1}) / std::max(max_fps, 1)}
+{
+    assert(max_fps > 0);
+}
+
+void FrameScheduler::Schedule(Window& window)
+{
+    assert(window);
+    if (IsScheduled(window)) return;
+    dirty_.push_back(&window);
+}
+
+void FrameScheduler::Unschedule(const Window& window)
+{
+    const auto it = std::find(dirty_.begin(), dirty_.end(), &window);
+    if (it != dirty_.end()) dirty_.erase(it);
+}
+
+bool FrameScheduler::IsScheduled(const Window& window) const
+{
+    return std::find(dirty_.begin(), dirty_.end(), &window) != dirty_.end();
+}
+
+Result FrameScheduler::Tick(Clock::time_point now)
+{
+    if (dirty_.empty() || now < next_frame_) return Result::Ok;
+    return FlushNow(now);
+}
+
+Result FrameScheduler::FlushNow(Clock::time_point now)
+{
+    if (dirty_.empty()) return Result::Ok;
+    auto ret = Result::Ok;
+    for (auto* window : dirty_)
+    {
+        if (window->Noutrefresh() == Result::Err) ret = Result::Err;
+    }
+    dirty_.clear();
+    if (Doupdate() == Result::Err) ret = Result::Err;
+    ++frame_count_;
+    next_frame_ = now + frame_period_;
+    return ret;
+}
+
+FrameScheduler::Clock::duration FrameScheduler::TimeUntilNextFrame(Clock::time_point now) const
+{
+    return std::max(next_frame_ - now, Clock::duration::zero());
+}
+
+} // namespace curses
@@ -0,0 +1,79 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_FRAME_SCHEDULER_HPP_
+#define CURSES_CPP_FRAME_SCHEDULER_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <chrono>
+#include <vector>
+
+namespace curses
+{
+
+// FrameScheduler collects windows that need to be refreshed and flushes
+// them to the terminal with a single Doupdate per frame, at most max_fps
+// times per second. This replaces calling Window::Refresh on every window,
+// which writes to the terminal once per window.
+//
+// The scheduler stores pointers to the scheduled windows. A window that is
+// destroyed or moved from while scheduled must first be unscheduled.
+class FrameScheduler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit FrameScheduler(int max_fps = 60);
+
+    // Mark window as dirty. It is refreshed in the next frame.
+    void Schedule(Window& window);
+    void Unschedule(const Window& window);
+    bool IsScheduled(const Window& window) const;
+    bool IsPending() const { return !dirty_.empty(); }
+
+    // Flush the scheduled windows if a frame is due, otherwise do nothing.
+    Result Tick(Clock::time_point now = Clock::now());
+
+    // Flush the scheduled windows immediately, e.g. to echo a keystroke.
+    // The flush counts as a frame, so the next Tick is paced after it.
+    Result FlushNow(Clock::time_point now = Clock::now());
+
+    Clock::duration GetFramePeriod() const { return frame_period_; }
+    Clock::time_point GetNextFrameTime() const { return next_frame_; }
+
+    // Time until the next frame is due, or zero if it is already due.
+    // Suitable as a timeout when waiting for input.
+    Clock::duration TimeUntilNextFrame(Clock::time_point now = Clock::now()) const;
+
+    // Number of frames flushed, i.e. number of calls to Doupdate
+    long GetFrameCount() const { return frame_count_; }
+
+private:
+    Clock::duration frame_period_;
+    Clock::time_point next_frame_{};
+    long frame_count_ = 0;
+    std::vector<Window*> dirty_;
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,173 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/input_latency.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <mutex>
+
+namespace curses
+{
+
+int LatencyHistogram::BucketIndex(std::uint64_t ns)
+{
+    if (ns < NumSubBuckets) return static_cast<int>(ns);
+    auto exponent = 0;  // Index of the highest set bit
+    for (auto v = ns; v > 1; v >>= 1) ++exponent;
+    const auto shift = exponent - SubBucketBits;
+    const auto sub_bucket = static_cast<int>((ns >> shift) & (NumSubBuckets - 1));
+    return (shift + 1) * NumSubBuckets + sub_bucket;
+}
+
+std::uint64_t LatencyHistogram::BucketUpperBound(int index)
+{
+    if (index < NumSubBuckets) return static_cast<std::uint64_t>(index);
+    const auto shift = index / NumSubBuckets - 1;
+    const auto sub_bucket = static_cast<std::uint64_t>(index % NumSubBuckets);
+    const auto lower = (NumSubBuckets + sub_bucket) << shift;
+    return lower + ((std::uint64_t{1} << shift) - 1);
+}
+
+void LatencyHistogram::Record(Duration duration)
+{
+    const auto ns = std::max<std::int64_t>(duration.count(), 0);
+    ++counts_[static_cast<std::size_t>(BucketIndex(static_cast<std::uint64_t>(ns)))];
+    ++count_;
+    min_ = std::min(min_, ns);
+    max_ = std::max(max_, ns);
+    sum_ += static_cast<long double>(ns);
+}
+
+LatencyHistogram::Duration LatencyHistogram::GetPercentile(double percentile) const
+{
+    assert(0 <= percentile && percentile <= 100);
+    if (count_ == 0) return Duration{0};
+    const auto target = std::max(1L, static_cast<long>(std::ceil(percentile / 100 * static_cast<double>(count_))));
+    auto seen = 0L;
+    for (int i = 0; i < NumBuckets; ++i)
+    {
+        seen += counts_[static_cast<std::size_t>(i)];
+        if (seen >= target)
+        {
+            const auto upper = static_cast<std::int64_t>(std::min<std::uint64_t>(BucketUpperBound(i), INT64_MAX));
+            return Duration{std::min(upper, max_)};
+        }
+    }
+    return GetMax();
+}
+
+Result LatencyHistogram::Write(std::FILE* file) const
+{
+    assert(file);
+    auto ok = std::fprintf(
+            file, "# count %ld min %lld mean %lld max %lld p50 %lld p99 %lld\n",
+            count_,
+            static_cast<long long>(GetMin().count()),
+            static_cast<long long>(GetMean().count()),
+            static_cast<long long>(GetMax().count()),
+            static_cast<long long>(GetPercentile(50).count()),
+            static_cast<long long>(GetPercentile(99).count())) >= 0;
+    for (int i = 0; i < NumBuckets && ok; ++i)
+    {
+        const auto count = counts_[static_cast<std::size_t>(i)];
+        if (count == 0) continue;
+        ok = std::fprintf(file, "%llu %ld\n", static_cast<unsigned long long>(BucketUpperBound(i)), count) >= 0;
+    }
+    return ok ? Result::Ok : Result::Err;
+}
+
+Result LatencyHistogram::Write(const char* path) const
+{
+    auto* file = std::fopen(path, "w");
+    if (!file) return Result::Err;
+    const auto res = Write(file);
+    const auto closed = std::fclose(file) == 0;
+    return res == Result::Ok && closed ? Result::Ok : Result::Err;
+}
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+// Keys stamped since the last paint. If more keys than this are read
+// without painting, the latest are not stamped.
+constexpr int MaxPendingInputs = 64;
+
+struct InputLatencyState
+{
+    std::mutex mutex;
+    std::array<Clock::time_point, MaxPendingInputs> pending{};
+    int num_pending = 0;
+    LatencyHistogram histogram;
+};
+
+InputLatencyState& GetState()
+{
+    static auto state = InputLatencyState{};
+    return state;
+}
+
+} // namespace
+
+LatencyHistogram GetInputLatency()
+{
+    auto& state = GetState();
+    const auto lock = std::lock_guard{state.mutex};
+    return state.histogram;
+}
+
+void ResetInputLatency()
+{
+    auto& state = GetState();
+    const auto lock = std::lock_guard{state.mutex};
+    state.histogram.Reset();
+    state.num_pending = 0;
+}
+
+namespace detail
+{
+
+void StampInput()
+{
+    const auto now = Clock::now();
+    auto& state = GetState();
+    const auto lock = std::lock_guard{state.mutex};
+    if (state.num_pending < MaxPendingInputs) state.pending[static_cast<std::size_t>(state.num_pending++)] = now;
+}
+
+void StampPaint()
+{
+    const auto now = Clock::now();
+    auto& state = GetState();
+    const auto lock = std::lock_guard{state.mutex};
+    for (int i = 0; i < state.num_pending; ++i)
+    {
+        state.histogram.Record(now - state.pending[static_cast<std::size_t>(i)]);
+    }
+    state.num_pending = 0;
+}
+
+} // namespace detail
+
+} // namespace curses
@@ -0,0 +1,107 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_INPUT_LATENCY_HPP_
+#define CURSES_CPP_INPUT_LATENCY_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace curses
+{
+
+// LatencyHistogram counts durations in logarithmic buckets, like an HDR
+// histogram: durations below 32 ns are exact, and every power of two above
+// is split into 32 buckets, so any recorded duration is known within about
+// 3 %. Recording is a few integer operations, and memory use is fixed.
+class LatencyHistogram
+{
+public:
+    using Duration = std::chrono::nanoseconds;
+
+    void Record(Duration duration);
+    void Reset() { *this = LatencyHistogram{}; }
+
+    long GetCount() const { return count_; }
+    Duration GetMin() const { return Duration{count_ == 0 ? 0 : min_}; }
+    Duration GetMax() const { return Duration{max_}; }
+    Duration GetMean() const { return Duration{count_ == 0 ? 0 : static_cast<std::int64_t>(sum_ / count_)}; }
+
+    // Smallest duration that is at least as large as percentile % of the
+    // recorded durations, rounded up to the end of its bucket. Zero if
+    // nothing is recorded.
+    Duration GetPercentile(double percentile) const;
+
+    // Write one line per nonempty bucket, "<upper bound in ns> <count>",
+    // preceded by a summary line starting with #
+    Result Write(std::FILE* file) const;
+    Result Write(const char* path) const;
+
+private:
+    static constexpr int SubBucketBits = 5;
+    static constexpr int NumSubBuckets = 1 << SubBucketBits;
+    static constexpr int NumBuckets = (64 - SubBucketBits + 1) * NumSubBuckets;
+
+    static int BucketIndex(std::uint64_t ns);
+    static std::uint64_t BucketUpperBound(int index);
+
+    std::array<long, NumBuckets> counts_{};
+    long count_ = 0;
+    std::int64_t min_ = INT64_MAX;
+    std::int64_t max_ = 0;
+    long double sum_ = 0;
+};
+
+// Input-to-paint latency. When the library is built with
+// CURSES_CPP_LATENCY_METRICS, every key returned by Window::Getch and
+// Window::GetchBatch (including Key::Mouse, but not Key::Resize) is stamped,
+// and the next Doupdate, Window::Refresh or Pad::Prefresh records the time
+// from each stamp to the end of the paint. Otherwise nothing is recorded and
+// the hooks compile to nothing.
+constexpr bool IsInputLatencyEnabled()
+{
+#if defined(CURSES_CPP_LATENCY_METRICS)
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Copy of the latencies recorded so far. Thread safe.
+LatencyHistogram GetInputLatency();
+void ResetInputLatency();
+
+namespace detail
+{
+
+// Called by the input and refresh wrappers
+void StampInput();
+void StampPaint();
+
+} // namespace detail
+
+} // namespace curses
+
+#endif // Include guard
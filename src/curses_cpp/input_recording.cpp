@@ -0,0 +1,218 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/input_recording.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+
+namespace curses
+{
+
+namespace
+{
+
+constexpr std::array<unsigned char, 5> Magic = {'C', 'C', 'I', 'R', 1};  // Last byte is the version
+
+// One encoded event, written to the file with a single fwrite
+class EventBuffer
+{
+public:
+    // Variable-length integers: 7 bits per byte, least significant first,
+    // with the high bit set on all but the last byte
+    void PutVarint(std::uint64_t value)
+    {
+        do
+        {
+            assert(size_ < buf_.size());
+            buf_[size_] = static_cast<unsigned char>(value & 0x7f);
+            value >>= 7;
+            if (value != 0) buf_[size_] |= 0x80;
+            ++size_;
+        } while (value != 0);
+    }
+
+    // Zigzag encoded, so that small negative values are short too
+    void PutSigned(std::int64_t value)
+    {
+        PutVarint((static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63));
+    }
+
+    bool Write(std::FILE* file) const
+    {
+        return std::fwrite(buf_.data(), 1, size_, file) == size_;
+    }
+
+private:
+    std::array<unsigned char, 70> buf_;  // Time, key and mouse event: 7 varints of at most 10 bytes
+    std::size_t size_ = 0;
+};
+
+// Return false at end of file or for a malformed integer
+bool ReadVarint(std::FILE* file, std::uint64_t& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        const auto c = std::fgetc(file);
+        if (c == EOF) return false;
+        value |= static_cast<std::uint64_t>(c & 0x7f) << shift;
+        if ((c & 0x80) == 0) return true;
+    }
+    return false;
+}
+
+bool ReadSigned(std::FILE* file, std::int64_t& value)
+{
+    auto zigzag = std::uint64_t{};
+    if (!ReadVarint(file, zigzag)) return false;
+    value = static_cast<std::int64_t>(zigzag >> 1) ^ -static_cast<std::int64_t>(zigzag & 1);
+    return true;
+}
+
+// Return true if there are no more bytes, i.e. the file ends between events
+bool AtEnd(std::FILE* file)
+{
+    const auto c = std::fgetc(file);
+    if (c == EOF) return true;
+    std::ungetc(c, file);
+    return false;
+}
+
+} // namespace
+
+InputRecorder::InputRecorder(const std::string& path, Clock::time_point start) :
+    file_{std::fopen(path.c_str(), "wb")},
+    start_{start}
+{
+    if (!file_ || std::fwrite(Magic.data(), 1, Magic.size(), file_.get()) != Magic.size())
+    {
+        throw std::runtime_error{"Can't create input recording " + path};
+    }
+}
+
+Result InputRecorder::Record(int key, Clock::time_point now)
+{
+    return Record(key, Mevent{}, now);
+}
+
+Result InputRecorder::Record(int key, const Mevent& mouse_event, Clock::time_point now)
+{
+    // Clamp, in case the clock isn't monotonic between callers
+    const auto time = std::max(std::chrono::duration_cast<std::chrono::microseconds>(now - start_), last_time_);
+    auto event = EventBuffer{};
+    event.PutVarint(static_cast<std::uint64_t>((time - last_time_).count()));
+    event.PutSigned(key);
+    if (key == Key::Mouse)
+    {
+        event.PutSigned(mouse_event.id);
+        event.PutSigned(mouse_event.x);
+        event.PutSigned(mouse_event.y);
+        event.PutSigned(mouse_event.z);
+        event.PutVarint(static_cast<std::uint64_t>(mouse_event.bstate));
+    }
+    // Keep the time of the last recorded event, so that the next delta is
+    // relative to it
+    if (!event.Write(file_.get())) return Result::Err;
+    last_time_ = time;
+    ++event_count_;
+    return Result::Ok;
+}
+
+Result InputRecorder::Record(const int* keys, const Mevent* mouse_events, int n, Clock::time_point now)
+{
+    assert(keys && n >= 0);
+    auto res = Result::Ok;
+    for (int i = 0; i < n; ++i)
+    {
+        const auto& mouse_event = mouse_events ? mouse_events[i] : Mevent{};
+        if (Record(keys[i], mouse_event, now) == Result::Err) res = Result::Err;
+    }
+    return res;
+}
+
+Result InputRecorder::Flush()
+{
+    return std::fflush(file_.get()) == 0 ? Result::Ok : Result::Err;
+}
+
+InputReplayer::InputReplayer(const std::string& path, Speed speed, Clock::time_point start) :
+    speed_{speed},
+    start_{start}
+{
+    const auto file = std::unique_ptr<std::FILE, detail::FileCloser>{std::fopen(path.c_str(), "rb")};
+    auto magic = decltype(Magic){};
+    if (!file || std::fread(magic.data(), 1, magic.size(), file.get()) != magic.size() || magic != Magic)
+    {
+        throw std::runtime_error{"Can't read input recording " + path};
+    }
+
+    auto time = std::chrono::microseconds{};
+    while (!AtEnd(file.get()))
+    {
+        auto delta = std::uint64_t{};
+        auto key = std::int64_t{};
+        auto ok = ReadVarint(file.get(), delta) && ReadSigned(file.get(), key);
+        auto event = InputEvent{};
+        time += std::chrono::microseconds{delta};
+        event.time = time;
+        event.key = static_cast<int>(key);
+        if (ok && event.key == Key::Mouse)
+        {
+            auto id = std::int64_t{};
+            auto x = std::int64_t{};
+            auto y = std::int64_t{};
+            auto z = std::int64_t{};
+            auto bstate = std::uint64_t{};
+            ok = ReadSigned(file.get(), id)
+                    && ReadSigned(file.get(), x)
+                    && ReadSigned(file.get(), y)
+                    && ReadSigned(file.get(), z)
+                    && ReadVarint(file.get(), bstate);
+            event.mouse_event = Mevent{
+                    static_cast<short>(id), static_cast<int>(x), static_cast<int>(y), static_cast<int>(z),
+                    static_cast<Mmask>(bstate)};
+        }
+        if (!ok) throw std::runtime_error{"Truncated input recording " + path};
+        events_.push_back(event);
+    }
+}
+
+bool InputReplayer::Feed(Clock::time_point now)
+{
+    if (IsDone() || TimeUntilNext(now) > Clock::duration::zero()) return false;
+    const auto& event = events_[next_++];
+    if (event.key == Key::Mouse) Ungetmouse(event.mouse_event);
+    else Ungetch(event.key);
+    return true;
+}
+
+InputReplayer::Clock::duration InputReplayer::TimeUntilNext(Clock::time_point now) const
+{
+    if (IsDone() || speed_ == Speed::AsFastAsPossible) return Clock::duration::zero();
+    const auto due = start_ + events_[next_].time;
+    return due > now ? due - now : Clock::duration::zero();
+}
+
+} // namespace curses
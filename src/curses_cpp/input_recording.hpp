@@ -0,0 +1,139 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_INPUT_RECORDING_HPP_
+#define CURSES_CPP_INPUT_RECORDING_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace curses
+{
+
+// A recorded key, and the mouse event if key is Key::Mouse. time is
+// relative to the start of the recording.
+struct InputEvent
+{
+    std::chrono::microseconds time{};
+    int key = 0;
+    Mevent mouse_event{};
+};
+
+namespace detail
+{
+
+struct FileCloser
+{
+    void operator()(std::FILE* file) const { std::fclose(file); }
+};
+
+} // namespace detail
+
+// InputRecorder writes keys and mouse events, with the time they were read,
+// to a file that InputReplayer can replay. Pass every key from Getch or
+// GetchBatch to Record.
+//
+// The file starts with a 4-byte magic and a version byte. Each event is
+// the time since the previous event in microseconds, the key, and for
+// Key::Mouse the fields of the mouse event, all as variable-length
+// integers, so most events take 2-3 bytes.
+class InputRecorder
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Throws std::runtime_error if path can't be opened for writing
+    explicit InputRecorder(const std::string& path, Clock::time_point start = Clock::now());
+
+    // Each event is written with one fwrite. Return Err, and don't count
+    // the event, if the write fails.
+    Result Record(int key, Clock::time_point now = Clock::now());
+    Result Record(int key, const Mevent& mouse_event, Clock::time_point now = Clock::now());
+    // Record the output of Window::GetchBatch
+    Result Record(const int* keys, const Mevent* mouse_events, int n, Clock::time_point now = Clock::now());
+
+    // Write buffered events to the file. Also done by the destructor.
+    Result Flush();
+
+    long GetEventCount() const { return event_count_; }
+
+private:
+    std::unique_ptr<std::FILE, detail::FileCloser> file_;
+    Clock::time_point start_;
+    std::chrono::microseconds last_time_{};
+    long event_count_ = 0;
+};
+
+// InputReplayer reads a file written by InputRecorder and feeds the events
+// back with Ungetch and Ungetmouse, one at a time, for example
+//
+//     auto replayer = InputReplayer{"session.rec", InputReplayer::Speed::Original};
+//     while (!replayer.IsDone())
+//     {
+//         const auto wait = std::chrono::ceil<std::chrono::milliseconds>(replayer.TimeUntilNext());
+//         window.Timeout(static_cast<int>(wait.count()));
+//         replayer.Feed();
+//         const auto key = window.Getch();  // Err if nothing was due
+//         ...
+//     }
+//
+// Only one event is fed at a time, since ncurses returns pushed back keys
+// in reverse order. Feed the next event after reading the previous one.
+class InputReplayer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Speed
+    {
+        Original,         // Feed each event at its recorded time
+        AsFastAsPossible, // Feed each event as soon as Feed is called
+    };
+
+    // Throws std::runtime_error if path can't be read or isn't a recording
+    explicit InputReplayer(const std::string& path, Speed speed = Speed::AsFastAsPossible, Clock::time_point start = Clock::now());
+
+    // Feed the next event if it is due. Return whether an event was fed.
+    bool Feed(Clock::time_point now = Clock::now());
+
+    // Time until the next event is due, zero if it is due or if all events
+    // have been fed
+    Clock::duration TimeUntilNext(Clock::time_point now = Clock::now()) const;
+
+    bool IsDone() const { return next_ == events_.size(); }
+    const std::vector<InputEvent>& GetEvents() const { return events_; }
+    int GetNumFed() const { return static_cast<int>(next_); }
+
+private:
+    std::vector<InputEvent> events_;
+    std::size_t next_ = 0;
+    Speed speed_;
+    Clock::time_point start_;
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,177 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_KEYMAP_HPP_
+#define CURSES_CPP_KEYMAP_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace curses
+{
+
+// Key code read by Getch for ch pressed with Ctrl, e.g. CtrlKey('x') for ^X
+constexpr int CtrlKey(char ch) { return ch & 037; }
+
+// Terminals send Escape before a key pressed with Alt
+constexpr int EscapeKey = 033;
+
+enum class KeyMatch
+{
+    None,      // The key is not bound
+    Prefix,    // The key starts or continues a chord
+    Complete,  // The key completes a binding
+};
+
+// KeyMap maps keys and chords (sequences of keys such as ^X ^S) to actions.
+// Action is a literal type, for example an enum or a function pointer. The
+// key map is typically built at compile time:
+//
+//     constexpr auto keymap = KeyMap<Command>{}
+//             .Bind('q', Command::Quit)
+//             .Bind(Key::Up, Command::Up)
+//             .Bind({CtrlKey('x'), CtrlKey('s')}, Command::Save)
+//             .BindAlt('f', Command::WordRight);
+//
+// The first key of a sequence is looked up in a dense table indexed by key
+// code. The rest of a chord is looked up in a trie, which holds at most
+// MaxChordKeys keys in total and whose children are searched linearly.
+template<typename Action, int MaxChordKeys = 32>
+class KeyMap
+{
+public:
+    // Keys 0 to KEY_MAX
+    static constexpr int NumKeys = 01000;
+
+    struct Match
+    {
+        KeyMatch match = KeyMatch::None;
+        Action action{};
+        int node = 0;  // Pass to the next Lookup if match is Prefix
+    };
+
+    constexpr KeyMap& Bind(int key, Action action)
+    {
+        const int keys[] = {key};
+        return Bind(keys, action);
+    }
+
+    // Bind a sequence of keys. A sequence can't be a prefix of another.
+    template<std::size_t N>
+    constexpr KeyMap& Bind(const int (&keys)[N], Action action)
+    {
+        static_assert(N > 0);
+        auto node = 0;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            auto& entry = FindOrAdd(node, keys[i]);
+            const auto is_last = i + 1 == N;
+            if (entry.is_bound || (is_last && entry.child != 0))
+            {
+                detail::ConstexprError("Key sequence conflicts with another binding");
+            }
+            if (is_last)
+            {
+                entry.action = action;
+                entry.is_bound = true;
+            }
+            else
+            {
+                if (entry.child == 0) entry.child = ++num_chord_nodes_;
+                node = entry.child;
+            }
+        }
+        return *this;
+    }
+
+    // Bind key pressed with Alt, i.e. Escape followed by key
+    constexpr KeyMap& BindAlt(int key, Action action)
+    {
+        const int keys[] = {EscapeKey, key};
+        return Bind(keys, action);
+    }
+
+    // Look up key after the keys that led to node, where node 0 is the start
+    // of a sequence. After None or Complete, start over at node 0.
+    constexpr Match Lookup(int key, int node = 0) const
+    {
+        const auto* entry = Find(node, key);
+        if (!entry || (!entry->is_bound && entry->child == 0)) return {};
+        if (entry->is_bound) return {KeyMatch::Complete, entry->action, 0};
+        return {KeyMatch::Prefix, Action{}, entry->child};
+    }
+
+private:
+    struct Entry
+    {
+        Action action{};
+        int child = 0;
+        bool is_bound = false;
+    };
+
+    struct Edge
+    {
+        int parent = 0;
+        int key = 0;
+        Entry entry{};
+    };
+
+    static constexpr bool IsValidKey(int key) { return 0 <= key && key < NumKeys; }
+
+    constexpr const Entry* Find(int node, int key) const
+    {
+        if (!IsValidKey(key)) return nullptr;
+        if (node == 0) return &root_[static_cast<std::size_t>(key)];
+        for (int i = 0; i < num_edges_; ++i)
+        {
+            const auto& edge = edges_[static_cast<std::size_t>(i)];
+            if (edge.parent == node && edge.key == key) return &edge.entry;
+        }
+        return nullptr;
+    }
+
+    constexpr Entry& FindOrAdd(int node, int key)
+    {
+        if (!IsValidKey(key)) detail::ConstexprError("Key code out of range");
+        if (node == 0) return root_[static_cast<std::size_t>(key)];
+        for (int i = 0; i < num_edges_; ++i)
+        {
+            auto& edge = edges_[static_cast<std::size_t>(i)];
+            if (edge.parent == node && edge.key == key) return edge.entry;
+        }
+        if (num_edges_ == MaxChordKeys) detail::ConstexprError("Too many chord keys in key map");
+        auto& edge = edges_[static_cast<std::size_t>(num_edges_++)];
+        edge.parent = node;
+        edge.key = key;
+        return edge.entry;
+    }
+
+    std::array<Entry, NumKeys> root_{};
+    std::array<Edge, MaxChordKeys> edges_{};
+    int num_edges_ = 0;
+    int num_chord_nodes_ = 0;
+};
+
+} // namespace curses
+
+#endif // Include guard
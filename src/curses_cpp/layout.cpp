@@ -0,0 +1,273 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/layout.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace curses
+{
+
+namespace
+{
+
+SizeLinesCols ToSize(PosYx yx) { return {yx.y, yx.x}; }
+
+PosYx operator+(PosYx a, PosYx b) { return {a.y + b.y, a.x + b.x}; }
+
+bool IsEmpty(SizeLinesCols size) { return size.lines <= 0 || size.cols <= 0; }
+
+} // namespace
+
+Layout::Layout(Window& root, Direction direction) :
+    root_{&root}
+{
+    auto& data = nodes_.emplace_back();
+    data.direction = direction;
+}
+
+Layout::~Layout()
+{
+    // Children have larger indices than their parents, and delwin fails for
+    // windows with live subwindows
+    for (auto i = GetNumNodes() - 1; i > Root; --i) nodes_[i].window = Window{};
+}
+
+Layout::Node Layout::Add(Node parent, LayoutSize size, Direction direction)
+{
+    assert(0 <= parent && parent < GetNumNodes());
+    const auto node = GetNumNodes();
+    auto& data = nodes_.emplace_back();
+    data.parent = parent;
+    data.size = size;
+    data.direction = direction;
+    nodes_[parent].children.push_back(node);
+    MarkDirty(parent);
+    return node;
+}
+
+LayoutSize Layout::GetLayoutSize(Node node) const
+{
+    return nodes_.at(node).size;
+}
+
+void Layout::SetLayoutSize(Node node, LayoutSize size)
+{
+    assert(node != Root);
+    auto& data = nodes_.at(node);
+    if (data.size == size) return;
+    data.size = size;
+    MarkDirty(data.parent);
+}
+
+Result Layout::Update()
+{
+    stats_ = {};
+    ++update_count_;
+    const auto begin = root_->Getbegyx();
+    const auto root_moved = begin != root_begin_;
+    root_begin_ = begin;
+    // If the root window moved, all windows must be moved on the screen
+    force_ = root_moved;
+    auto& root = nodes_[Root];
+    const auto changed = Place(Root, {}, ToSize(root_->Getmaxyx()));
+    auto ok = true;
+    if (changed || root.dirty) ok = Reflow(Root);
+    force_ = false;
+    return ok ? Result::Ok : Result::Err;
+}
+
+Window& Layout::GetWindow(Node node)
+{
+    if (node == Root) return *root_;
+    return nodes_.at(node).window;
+}
+
+PosYx Layout::GetTopLeft(Node node) const
+{
+    return nodes_.at(node).top_left;
+}
+
+SizeLinesCols Layout::GetSize(Node node) const
+{
+    return nodes_.at(node).lines_cols;
+}
+
+bool Layout::IsChanged(Node node) const
+{
+    return nodes_.at(node).changed_update == update_count_;
+}
+
+void Layout::MarkDirty(Node node)
+{
+    // Ancestors of dirty nodes are dirty, so stop at the first one
+    for (; node != -1 && !nodes_[node].dirty; node = nodes_[node].parent)
+    {
+        nodes_[node].dirty = true;
+    }
+}
+
+bool Layout::Reflow(Node node)
+{
+    auto& data = nodes_[node];
+    data.dirty = false;
+    if (data.children.empty()) return true;
+    ++stats_.visited;
+    const auto horizontal = data.direction == Direction::Horizontal;
+    const auto total = std::max(horizontal ? data.lines_cols.cols : data.lines_cols.lines, 0);
+    const auto cross = std::max(horizontal ? data.lines_cols.lines : data.lines_cols.cols, 0);
+    const auto n = static_cast<int>(data.children.size());
+
+    // Fixed nodes first, then flex nodes share what is left by weight. Flex
+    // nodes whose share is below their minimum get the minimum instead, and
+    // the rest share again. -1 marks flex nodes that are not yet sized.
+    auto& sizes = scratch_;
+    sizes.assign(n, -1);
+    auto remaining = total;
+    for (int i = 0; i < n; ++i)
+    {
+        const auto size = nodes_[data.children[i]].size;
+        if (size.fixed < 0) continue;
+        sizes[i] = std::clamp(size.fixed, 0, std::max(remaining, 0));
+        remaining -= sizes[i];
+    }
+    auto weight_sum = 0LL;
+    for (auto resolved = false; !resolved;)
+    {
+        resolved = true;
+        weight_sum = 0;
+        for (int i = 0; i < n; ++i)
+        {
+            if (sizes[i] < 0) weight_sum += std::max(nodes_[data.children[i]].size.weight, 0);
+        }
+        for (int i = 0; i < n; ++i)
+        {
+            if (sizes[i] >= 0) continue;
+            const auto size = nodes_[data.children[i]].size;
+            const auto share = weight_sum > 0 ? static_cast<long long>(std::max(remaining, 0)) * std::max(size.weight, 0) / weight_sum : 0;
+            if (share >= size.min_cells) continue;
+            sizes[i] = size.min_cells;
+            remaining -= size.min_cells;
+            resolved = false;
+        }
+    }
+    const auto available = std::max(remaining, 0);
+    auto& shared = scratch_shared_;
+    shared.clear();
+    auto assigned = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        if (sizes[i] >= 0) continue;
+        const auto weight = std::max(nodes_[data.children[i]].size.weight, 0);
+        sizes[i] = weight_sum > 0 ? static_cast<int>(static_cast<long long>(available) * weight / weight_sum) : 0;
+        assigned += sizes[i];
+        if (weight > 0) shared.push_back(i);
+    }
+    // Hand out the cells lost to rounding, one per node from the start
+    for (auto it = shared.begin(); it != shared.end() && assigned < available; ++it)
+    {
+        ++sizes[*it];
+        ++assigned;
+    }
+
+    // Place the children, clipping the ones that don't fit, and update their
+    // windows before laying out their own children
+    auto ok = true;
+    auto pos = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        const auto child = data.children[i];
+        const auto size = std::min(sizes[i], total - pos);
+        const auto top_left = horizontal ? PosYx{0, pos} : PosYx{pos, 0};
+        const auto lines_cols = horizontal ? SizeLinesCols{cross, size} : SizeLinesCols{size, cross};
+        pos += size;
+        if (Place(child, top_left, lines_cols)) ok = UpdateWindow(child) && ok;
+    }
+    for (const auto child : data.children)
+    {
+        if (IsChanged(child) || nodes_[child].dirty) ok = Reflow(child) && ok;
+    }
+    return ok;
+}
+
+bool Layout::Place(Node node, PosYx top_left, SizeLinesCols lines_cols)
+{
+    auto& data = nodes_[node];
+    const auto top_left_abs = node == Root ? PosYx{} : nodes_[data.parent].top_left_abs + top_left;
+    const auto changed = force_ ||
+            top_left_abs != data.top_left_abs ||
+            lines_cols != data.lines_cols ||
+            data.changed_update == -1;
+    data.top_left = top_left;
+    data.top_left_abs = top_left_abs;
+    data.lines_cols = lines_cols;
+    if (changed) data.changed_update = update_count_;
+    return changed;
+}
+
+bool Layout::UpdateWindow(Node node)
+{
+    auto& data = nodes_[node];
+    if (IsEmpty(data.lines_cols))
+    {
+        DestroyWindows(node);
+        return true;
+    }
+    auto& parent = GetWindow(data.parent);
+    if (!data.window.Get())
+    {
+        data.window = parent.Derwin(data.lines_cols, data.top_left);
+        ++stats_.created;
+        return true;
+    }
+
+    const auto [lines, cols] = data.lines_cols;
+    const auto current = ToSize(data.window.Getmaxyx());
+    const auto screen_top_left = root_begin_ + data.top_left_abs;
+    const auto resize = current != data.lines_cols;
+    const auto move = data.window.Getparyx() != data.top_left || data.window.Getbegyx() != screen_top_left;
+    auto ok = true;
+    // Shrink first, so that the window fits in its parent both before and
+    // after it has been moved
+    const auto shrunk = SizeLinesCols{std::min(current.lines, lines), std::min(current.cols, cols)};
+    if (shrunk != current) ok = data.window.Resize(shrunk) == Result::Ok && ok;
+    if (move)
+    {
+        ok = data.window.Mvderwin(data.top_left) == Result::Ok && ok;
+        ok = data.window.Mvwin(screen_top_left) == Result::Ok && ok;
+        ++stats_.moved;
+    }
+    if (shrunk != data.lines_cols) ok = data.window.Resize(data.lines_cols) == Result::Ok && ok;
+    if (resize) ++stats_.resized;
+    return ok;
+}
+
+void Layout::DestroyWindows(Node node)
+{
+    auto& data = nodes_[node];
+    for (const auto child : data.children) DestroyWindows(child);
+    if (!data.window.Get()) return;
+    data.window = Window{};
+    ++stats_.destroyed;
+}
+
+} // namespace curses
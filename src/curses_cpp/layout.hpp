@@ -0,0 +1,154 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_LAYOUT_HPP_
+#define CURSES_CPP_LAYOUT_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <deque>
+#include <vector>
+
+namespace curses
+{
+
+// Size of a layout node along the direction of its parent
+struct LayoutSize
+{
+    static constexpr LayoutSize Fixed(int cells) { return {cells, 0, 0}; }
+    static constexpr LayoutSize Flex(int weight = 1, int min_cells = 0) { return {-1, weight, min_cells}; }
+
+    int fixed = -1;     // Number of cells, or -1 for flex
+    int weight = 1;     // Share of the space left after fixed nodes
+    int min_cells = 0;  // Minimum size of a flex node
+};
+
+constexpr bool operator==(LayoutSize a, LayoutSize b)
+{
+    return a.fixed == b.fixed && a.weight == b.weight && a.min_cells == b.min_cells;
+}
+
+constexpr bool operator!=(LayoutSize a, LayoutSize b)
+{
+    return !(a == b);
+}
+
+// Layout arranges a tree of nodes in a root window. Each node has a Derwin
+// window, derived from the window of its parent node, and its children are
+// laid out in a row or a column within it. Along that direction each child
+// has a fixed or flexible size; across it, children fill their parent.
+//
+// Update recomputes the geometry after the root window has been resized or
+// sizes have been changed. Only subtrees whose geometry or sizes changed are
+// visited, and existing windows are moved with Mvderwin/Mvwin and resized
+// with Window::Resize instead of being recreated. Nodes that get an empty size have
+// no window until they get a non-empty size again.
+//
+// Since derived windows share memory with the root window, nodes that moved
+// or changed size must be redrawn after Update, see IsChanged.
+class Layout
+{
+public:
+    using Node = int;
+
+    enum class Direction
+    {
+        Horizontal, // Children left to right
+        Vertical,   // Children top to bottom
+    };
+
+    struct Stats
+    {
+        int visited = 0;    // Nodes whose children were laid out
+        int created = 0;    // Windows created with Derwin
+        int moved = 0;      // Windows moved
+        int resized = 0;    // Windows resized
+        int destroyed = 0;  // Windows destroyed due to empty size
+    };
+
+    static constexpr Node Root = 0;
+
+    // root must outlive the Layout
+    explicit Layout(Window& root, Direction direction = Direction::Vertical);
+
+    Layout(const Layout&) = delete;
+    Layout& operator=(const Layout&) = delete;
+
+    ~Layout();
+
+    // Add a child last in parent. Takes effect on the next Update.
+    Node Add(Node parent, LayoutSize size, Direction direction = Direction::Vertical);
+
+    LayoutSize GetLayoutSize(Node node) const;
+    void SetLayoutSize(Node node, LayoutSize size);
+
+    // Recompute the geometry and update the windows of changed nodes
+    Result Update();
+
+    // The window of node, or the root window for Root. Empty if the node has
+    // an empty size.
+    Window& GetWindow(Node node);
+
+    // Geometry relative to the parent node's window, as of the last Update
+    PosYx GetTopLeft(Node node) const;
+    SizeLinesCols GetSize(Node node) const;
+
+    // Whether the geometry of node changed in the last Update
+    bool IsChanged(Node node) const;
+
+    int GetNumNodes() const { return static_cast<int>(nodes_.size()); }
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    struct NodeData
+    {
+        Node parent = -1;
+        LayoutSize size{};
+        Direction direction = Direction::Vertical;
+        std::vector<Node> children;
+        PosYx top_left{};       // In parent's window
+        PosYx top_left_abs{};   // In root window
+        SizeLinesCols lines_cols{};
+        bool dirty = true;      // Children of this node or its descendants need layout
+        long changed_update = -1;
+        Window window;
+    };
+
+    void MarkDirty(Node node);
+    bool Reflow(Node node);
+    bool Place(Node node, PosYx top_left, SizeLinesCols lines_cols);
+    bool UpdateWindow(Node node);
+    void DestroyWindows(Node node);
+
+    Window* root_;
+    PosYx root_begin_{};
+    long update_count_ = 0;
+    bool force_ = false;
+    // Deque, since Windows keep a pointer to their parent Window
+    std::deque<NodeData> nodes_;
+    std::vector<int> scratch_;
+    std::vector<int> scratch_shared_;
+    Stats stats_{};
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,241 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/line_editor.hpp"
+
+#include "curses_cpp/build_internal/isize.hpp"
+#include "curses_cpp/keymap.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace curses
+{
+
+LineEditor::LineEditor(Window& window, PosYx top_left) :
+    window_{&window},
+    top_left_{top_left}
+{
+    Redraw();
+}
+
+LineEditor::Status LineEditor::HandleKey(int key)
+{
+    if (status_ != Status::Editing) return status_;
+    const auto size = ISize(line_);
+    switch (key)
+    {
+    case Key::Left:
+    case CtrlKey('b'):
+        cursor_ = std::max(cursor_ - 1, 0);
+        break;
+    case Key::Right:
+    case CtrlKey('f'):
+        cursor_ = std::min(cursor_ + 1, size);
+        break;
+    case Key::Home:
+    case CtrlKey('a'):
+        cursor_ = 0;
+        break;
+    case Key::End:
+    case CtrlKey('e'):
+        cursor_ = size;
+        break;
+    case Key::Backspace:
+    case CtrlKey('h'):
+    case 0177:
+        if (cursor_ > 0) Erase(cursor_ - 1, cursor_);
+        break;
+    case Key::Dc:
+    case CtrlKey('d'):
+        if (cursor_ < size) Erase(cursor_, cursor_ + 1);
+        break;
+    case CtrlKey('k'):
+        Kill(cursor_, size);
+        break;
+    case CtrlKey('u'):
+        Kill(0, cursor_);
+        break;
+    case CtrlKey('w'):
+    {
+        auto first = cursor_;
+        while (first > 0 && line_[first - 1] == ' ') --first;
+        while (first > 0 && line_[first - 1] != ' ') --first;
+        Kill(first, cursor_);
+        break;
+    }
+    case CtrlKey('y'):
+        Insert(kill_buffer_);
+        break;
+    case Key::Up:
+    case CtrlKey('p'):
+        MoveInHistory(-1);
+        break;
+    case Key::Down:
+    case CtrlKey('n'):
+        MoveInHistory(1);
+        break;
+    case '\t':
+        Complete();
+        break;
+    case '\n':
+    case '\r':
+    case Key::Enter:
+        status_ = Status::Accepted;
+        if (!line_.empty() && (history_.empty() || history_.back() != line_)) history_.push_back(line_);
+        history_index_ = ISize(history_);
+        break;
+    case EscapeKey:
+    case CtrlKey('g'):
+        status_ = Status::Cancelled;
+        break;
+    default:
+        // Printable ASCII. Other bytes, such as those of UTF-8 sequences,
+        // would not take one column each.
+        if (' ' <= key && key < 0177)
+        {
+            Insert(static_cast<char>(key));
+            break;
+        }
+        return status_;
+    }
+    Redraw();
+    return status_;
+}
+
+void LineEditor::SetLine(std::string_view line)
+{
+    line_.assign(line);
+    cursor_ = ISize(line_);
+    status_ = Status::Editing;
+    history_index_ = ISize(history_);
+    Redraw();
+}
+
+void LineEditor::SetHistory(std::vector<std::string> history)
+{
+    history_ = std::move(history);
+    history_index_ = ISize(history_);
+}
+
+void LineEditor::Insert(char ch)
+{
+    line_.insert(static_cast<std::size_t>(cursor_), 1, ch);
+    ++cursor_;
+    history_index_ = ISize(history_);
+}
+
+void LineEditor::Insert(std::string_view text)
+{
+    Replace(cursor_, cursor_, text);
+}
+
+void LineEditor::Replace(int first, int last, std::string_view text)
+{
+    assert(0 <= first && first <= last && last <= ISize(line_));
+    line_.replace(static_cast<std::size_t>(first), static_cast<std::size_t>(last - first), text);
+    cursor_ = first + ISize(text);
+    history_index_ = ISize(history_);
+}
+
+void LineEditor::Erase(int first, int last)
+{
+    assert(0 <= first && first <= last && last <= ISize(line_));
+    line_.erase(static_cast<std::size_t>(first), static_cast<std::size_t>(last - first));
+    if (cursor_ > first) cursor_ = std::max(first, cursor_ - (last - first));
+    history_index_ = ISize(history_);
+}
+
+void LineEditor::Kill(int first, int last)
+{
+    if (first == last) return;
+    kill_buffer_ = line_.substr(static_cast<std::size_t>(first), static_cast<std::size_t>(last - first));
+    Erase(first, last);
+}
+
+void LineEditor::Complete()
+{
+    if (!completer_) return;
+    auto first = cursor_;
+    while (first > 0 && line_[first - 1] != ' ') --first;
+    const auto word = line_.substr(static_cast<std::size_t>(first), static_cast<std::size_t>(cursor_ - first));
+    const auto candidates = completer_(word);
+    if (candidates.empty()) return;
+
+    auto common = std::string_view{candidates.front()};
+    for (const auto& candidate : candidates)
+    {
+        const auto length = std::min(common.size(), candidate.size());
+        const auto mismatch = std::mismatch(common.begin(), common.begin() + length, candidate.begin());
+        common = common.substr(0, static_cast<std::size_t>(mismatch.first - common.begin()));
+    }
+    if (candidates.size() == 1)
+    {
+        Replace(first, cursor_, candidates.front() + ' ');
+    }
+    else if (common.size() > word.size())
+    {
+        Replace(first, cursor_, common);
+    }
+}
+
+void LineEditor::MoveInHistory(int direction)
+{
+    const auto size = ISize(history_);
+    if (history_index_ == size) history_prefix_ = line_;
+    auto i = history_index_ + direction;
+    while (0 <= i && i < size && history_[i].compare(0, history_prefix_.size(), history_prefix_) != 0) i += direction;
+    if (i < 0) return;  // No earlier match
+    history_index_ = std::min(i, size);
+    line_ = history_index_ == size ? history_prefix_ : history_[i];
+    cursor_ = ISize(line_);
+}
+
+void LineEditor::Redraw()
+{
+    const auto width = window_->Getmaxyx().x - top_left_.x;
+    if (width <= 0) return;
+
+    // Keep the cursor visible
+    if (cursor_ < scroll_) scroll_ = cursor_;
+    if (cursor_ > scroll_ + width - 1) scroll_ = cursor_ - width + 1;
+    scroll_ = std::min(scroll_, ISize(line_));
+
+    const auto visible = std::string_view{line_}.substr(static_cast<std::size_t>(scroll_), static_cast<std::size_t>(width));
+    const auto common = std::mismatch(
+            visible.begin(), visible.begin() + std::min(visible.size(), shown_.size()), shown_.begin());
+    const auto first = static_cast<int>(common.first - visible.begin());
+    if (first < ISize(visible))
+    {
+        window_->Addstr({top_left_.y, top_left_.x + first}, visible.substr(static_cast<std::size_t>(first)));
+        chars_drawn_ += ISize(visible) - first;
+    }
+    if (ISize(visible) < ISize(shown_))
+    {
+        window_->Move({top_left_.y, top_left_.x + ISize(visible)});
+        window_->Clrtoeol();
+    }
+    shown_.assign(visible);
+    window_->Move({top_left_.y, top_left_.x + cursor_ - scroll_});
+}
+
+} // namespace curses
@@ -0,0 +1,125 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_LINE_EDITOR_HPP_
+#define CURSES_CPP_LINE_EDITOR_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace curses
+{
+
+// LineEditor edits one line of text, one key at a time, as a non-blocking
+// replacement for Window::Getstr. Pass each key from Getch, GetchBatch or
+// an EventLoop to HandleKey, and refresh the window when convenient.
+//
+// The line is shown from top_left to the right edge of the window, and
+// scrolls horizontally to keep the cursor visible. Only printable ASCII is
+// inserted, so that each character is one byte and takes one column; other
+// keys, including the bytes of UTF-8 sequences, are ignored. After an edit
+// only the part of the line that changed is redrawn, with Addstr and
+// Clrtoeol.
+//
+// Keys, as in readline:
+//   Left, ^B / Right, ^F       Move one character
+//   Home, ^A / End, ^E         Move to the start / end
+//   Backspace, ^H / Delete, ^D Delete before / at the cursor
+//   ^K / ^U / ^W               Kill to the end / to the start / the word
+//                              before the cursor
+//   ^Y                         Yank the last killed text
+//   Up, ^P / Down, ^N          Previous / next history entry that starts
+//                              with the text typed before moving
+//   Tab                        Complete the word before the cursor
+//   Enter                      Accept the line and add it to the history
+//   Escape, ^G                 Cancel
+class LineEditor
+{
+public:
+    enum class Status
+    {
+        Editing,
+        Accepted,
+        Cancelled,
+    };
+
+    // Return the candidates that complete word, which is the text between
+    // the previous space and the cursor
+    using Completer = std::function<std::vector<std::string>(std::string_view word)>;
+
+    // Edit in window, which must outlive the editor
+    LineEditor(Window& window, PosYx top_left);
+
+    // Handle key and redraw. After Accepted or Cancelled, Clear starts a new
+    // line; until then further keys are ignored.
+    Status HandleKey(int key);
+
+    const std::string& GetLine() const { return line_; }
+    int GetCursor() const { return cursor_; }
+    Status GetStatus() const { return status_; }
+
+    // Replace the line, with the cursor at the end
+    void SetLine(std::string_view line);
+    void Clear() { SetLine({}); }
+
+    // With more than one candidate, the common prefix of the candidates is
+    // inserted
+    void SetCompleter(Completer completer) { completer_ = std::move(completer); }
+
+    const std::vector<std::string>& GetHistory() const { return history_; }
+    void SetHistory(std::vector<std::string> history);
+
+    // Number of characters written to the window by all redraws
+    long GetCharsDrawn() const { return chars_drawn_; }
+
+private:
+    void Insert(char ch);
+    void Insert(std::string_view text);
+    // Replace the text from first to last, with the cursor after text
+    void Replace(int first, int last, std::string_view text);
+    void Erase(int first, int last);
+    void Kill(int first, int last);
+    void Complete();
+    void MoveInHistory(int direction);
+    void Redraw();
+
+    Window* window_;
+    PosYx top_left_;
+    std::string line_;
+    int cursor_ = 0;
+    Status status_ = Status::Editing;
+    std::string kill_buffer_;
+    Completer completer_;
+    std::vector<std::string> history_;
+    int history_index_ = 0;          // history_.size() when not in the history
+    std::string history_prefix_;     // Line before moving into the history
+    int scroll_ = 0;                 // Index of the first visible character
+    std::string shown_;              // Visible text as drawn in the window
+    long chars_drawn_ = 0;
+};
+
+} // namespace curses
+
+#endif // Include guard
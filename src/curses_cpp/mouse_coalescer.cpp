@@ -0,0 +1,55 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/mouse_coalescer.hpp"
+
+#include <cassert>
+
+namespace curses
+{
+
+bool MouseCoalescer::IsMotion(const Mevent& event)
+{
+    const auto modifiers = Mmask::ButtonShift | Mmask::ButtonCtrl | Mmask::ButtonAlt;
+    return (event.bstate | modifiers) == (Mmask::ReportMousePosition | modifiers);
+}
+
+int MouseCoalescer::Coalesce(int* keys, Mevent* mouse_events, int n)
+{
+    assert(keys && mouse_events && n >= 0);
+    auto out = 0;
+    for (int i = 0; i < n; ++i)
+    {
+        const auto is_motion = keys[i] == Key::Mouse && IsMotion(mouse_events[i]);
+        if (is_motion && out > 0 && keys[out - 1] == Key::Mouse && IsMotion(mouse_events[out - 1]))
+        {
+            mouse_events[out - 1] = mouse_events[i];
+            ++merged_count_;
+            continue;
+        }
+        keys[out] = keys[i];
+        mouse_events[out] = mouse_events[i];
+        ++out;
+    }
+    return out;
+}
+
+} // namespace curses
@@ -0,0 +1,55 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_MOUSE_COALESCER_HPP_
+#define CURSES_CPP_MOUSE_COALESCER_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+namespace curses
+{
+
+// MouseCoalescer merges runs of mouse motion events, as reported with
+// Mmask::ReportMousePosition, into the last event of each run. Button
+// events and other keys are kept, in order, so a fast drag costs one event
+// per batch of input instead of one per reported position.
+class MouseCoalescer
+{
+public:
+    // Whether event only reports the mouse position, possibly with
+    // modifiers, without any button transition
+    static bool IsMotion(const Mevent& event);
+
+    // Compact the first n keys and mouse events, as read by
+    // Window::GetchBatch, in place. Return the new number of keys.
+    int Coalesce(int* keys, Mevent* mouse_events, int n);
+
+    // Number of events merged into later events
+    long GetMergedCount() const { return merged_count_; }
+    void ResetMergedCount() { merged_count_ = 0; }
+
+private:
+    long merged_count_ = 0;
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,100 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_MPSC_QUEUE_HPP_
+#define CURSES_CPP_MPSC_QUEUE_HPP_
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace curses
+{
+
+// MpscQueue is an unbounded, lock-free multiple-producer single-consumer
+// queue (Dmitry Vyukov's node-based design). Push may be called from any
+// thread and never blocks. TryPop must only be called from one thread at a
+// time.
+//
+// An element whose Push has not completed yet may be invisible to TryPop
+// even if later elements are visible, until the Push completes.
+template<typename T>
+class MpscQueue
+{
+public:
+    MpscQueue() :
+        head_{new Node{}},
+        tail_{head_.load(std::memory_order_relaxed)}
+    {}
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+
+    ~MpscQueue()
+    {
+        while (TryPop()) {}
+        delete tail_;
+    }
+
+    void Push(T value)
+    {
+        auto* node = new Node{};
+        node->value.emplace(std::move(value));
+        auto* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    std::optional<T> TryPop()
+    {
+        // tail_ is a consumed node. Its successor holds the next value and
+        // becomes the new consumed node.
+        auto* tail = tail_;
+        auto* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) return std::nullopt;
+        auto ret = std::move(next->value);
+        next->value.reset();
+        tail_ = next;
+        delete tail;
+        return ret;
+    }
+
+    // Approximate: may return true while a Push is in progress
+    bool IsEmpty() const
+    {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct Node
+    {
+        std::atomic<Node*> next{nullptr};
+        std::optional<T> value;
+    };
+
+    std::atomic<Node*> head_;   // Last pushed node, written by producers
+    Node* tail_;                // Last consumed node, owned by the consumer
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,112 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/curses.hpp"
+
+#include <cstddef>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CURSES_CPP_PACK_CHTYPE_AVX2
+#include <immintrin.h>
+#endif
+
+namespace curses
+{
+
+namespace
+{
+
+void PackChtypeScalar(const unsigned char* in, std::size_t n, unsigned attr, Chtype* out)
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        out[i] = Chtype{in[i] | attr};
+    }
+}
+
+#if defined(__SSE2__)
+void PackChtypeSse2(const unsigned char* in, std::size_t n, unsigned attr, Chtype* out)
+{
+    const auto zero = _mm_setzero_si128();
+    const auto a = _mm_set1_epi32(static_cast<int>(attr));
+    auto i = std::size_t{0};
+    for (; i + 16 <= n; i += 16)
+    {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const auto lo = _mm_unpacklo_epi8(bytes, zero);
+        const auto hi = _mm_unpackhi_epi8(bytes, zero);
+        auto* dst = reinterpret_cast<__m128i*>(out + i);
+        _mm_storeu_si128(dst + 0, _mm_or_si128(_mm_unpacklo_epi16(lo, zero), a));
+        _mm_storeu_si128(dst + 1, _mm_or_si128(_mm_unpackhi_epi16(lo, zero), a));
+        _mm_storeu_si128(dst + 2, _mm_or_si128(_mm_unpacklo_epi16(hi, zero), a));
+        _mm_storeu_si128(dst + 3, _mm_or_si128(_mm_unpackhi_epi16(hi, zero), a));
+    }
+    PackChtypeScalar(in + i, n - i, attr, out + i);
+}
+#endif
+
+#if defined(CURSES_CPP_PACK_CHTYPE_AVX2)
+__attribute__((target("avx2")))
+void PackChtypeAvx2(const unsigned char* in, std::size_t n, unsigned attr, Chtype* out)
+{
+    const auto a = _mm256_set1_epi32(static_cast<int>(attr));
+    auto i = std::size_t{0};
+    for (; i + 16 <= n; i += 16)
+    {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const auto lo = _mm256_cvtepu8_epi32(bytes);
+        const auto hi = _mm256_cvtepu8_epi32(_mm_unpackhi_epi64(bytes, bytes));
+        auto* dst = reinterpret_cast<__m256i*>(out + i);
+        _mm256_storeu_si256(dst + 0, _mm256_or_si256(lo, a));
+        _mm256_storeu_si256(dst + 1, _mm256_or_si256(hi, a));
+    }
+    PackChtypeScalar(in + i, n - i, attr, out + i);
+}
+#endif
+
+using PackChtypeFn = void (*)(const unsigned char*, std::size_t, unsigned, Chtype*);
+
+PackChtypeFn SelectPackChtype()
+{
+#if defined(CURSES_CPP_PACK_CHTYPE_AVX2)
+    if (__builtin_cpu_supports("avx2")) return PackChtypeAvx2;
+#endif
+#if defined(__SSE2__)
+    return PackChtypeSse2;
+#else
+    return PackChtypeScalar;
+#endif
+}
+
+} // namespace
+
+void PackChtype(std::string_view text, Attr attr, Chtype* out)
+{
+    static_assert(sizeof(Chtype) == sizeof(unsigned), "no padding in Chtype");
+    static const auto pack = SelectPackChtype();
+    pack(reinterpret_cast<const unsigned char*>(text.data()), text.size(), static_cast<unsigned>(attr), out);
+}
+
+} // namespace curses
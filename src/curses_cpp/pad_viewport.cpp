@@ -0,0 +1,134 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/pad_viewport.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <utility>
+
+namespace curses
+{
+
+PadViewport::PadViewport(
+        SizeLinesCols view_size,
+        PosYx view_top_left,
+        int num_lines,
+        int cols,
+        LineSource source,
+        int band_lines) :
+    view_size_{view_size},
+    view_top_left_{view_top_left},
+    num_lines_{std::max(num_lines, 0)},
+    cols_{std::max(cols, view_size.cols)},
+    source_{std::move(source)},
+    band_lines_{std::max(band_lines > 0 ? band_lines : 3 * view_size.lines, view_size.lines)}
+{
+    assert(view_size.lines > 0 && view_size.cols > 0);
+    assert(source_);
+    pad_ = Pad{{band_lines_, cols_}};
+}
+
+void PadViewport::SetNumLines(int num_lines)
+{
+    num_lines_ = std::max(num_lines, 0);
+    Invalidate();
+    ScrollTo(top_);
+}
+
+void PadViewport::InvalidateLine(int line)
+{
+    if (!valid_ || line < band_first_ || line >= band_first_ + band_lines_) return;
+    Fetch(line, 1);
+}
+
+void PadViewport::ScrollTo(int top)
+{
+    top_ = std::clamp(top, 0, std::max(num_lines_ - view_size_.lines, 0));
+}
+
+void PadViewport::ScrollToCol(int left)
+{
+    left_ = std::clamp(left, 0, cols_ - view_size_.cols);
+}
+
+Result PadViewport::Refresh()
+{
+    Materialize();
+    return pad_.Prefresh({top_ - band_first_, left_}, view_top_left_, ScreenMax());
+}
+
+Result PadViewport::Noutrefresh()
+{
+    Materialize();
+    return pad_.Pnoutrefresh({top_ - band_first_, left_}, view_top_left_, ScreenMax());
+}
+
+void PadViewport::Materialize()
+{
+    const auto view_end = top_ + view_size_.lines;
+    if (valid_ && band_first_ <= top_ && view_end <= band_first_ + band_lines_) return;
+
+    // Center the view in the new band
+    const auto margin = (band_lines_ - view_size_.lines) / 2;
+    const auto new_first = std::clamp(top_ - margin, 0, std::max(num_lines_ - band_lines_, 0));
+    const auto shift = new_first - band_first_;
+    const auto old_first = band_first_;
+    band_first_ = new_first;
+
+    if (!valid_ || std::abs(shift) >= band_lines_)
+    {
+        pad_.Erase();
+        Fetch(band_first_, band_lines_);
+    }
+    else if (shift != 0)
+    {
+        // Scrolling is only enabled here, so that the line source can write
+        // to the bottom-right corner without scrolling the pad
+        pad_.Scrollok();
+        pad_.Scroll(shift);
+        pad_.Scrollok(false);
+        if (shift > 0) Fetch(old_first + band_lines_, shift);
+        else Fetch(band_first_, -shift);
+    }
+    valid_ = true;
+}
+
+void PadViewport::Fetch(int first, int count)
+{
+    const auto last = std::min(first + count, num_lines_);
+    for (int line = first; line < last; ++line)
+    {
+        const auto pad_line = line - band_first_;
+        pad_.Move({pad_line, 0});
+        pad_.Clrtoeol();
+        source_(pad_, pad_line, line);
+        ++fetch_count_;
+    }
+}
+
+PosYx PadViewport::ScreenMax() const
+{
+    return {view_top_left_.y + view_size_.lines - 1, view_top_left_.x + view_size_.cols - 1};
+}
+
+} // namespace curses
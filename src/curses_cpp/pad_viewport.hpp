@@ -0,0 +1,103 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_PAD_VIEWPORT_HPP_
+#define CURSES_CPP_PAD_VIEWPORT_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <functional>
+
+namespace curses
+{
+
+// PadViewport shows a scrollable document with a large number of lines in a
+// part of the screen. Only a band of lines around the visible ones is kept
+// in a Pad. When scrolling outside the band, the pad is scrolled and only
+// the newly exposed lines are fetched from the line source, so memory use
+// and scroll cost don't depend on the length of the document.
+class PadViewport
+{
+public:
+    // Draw line `line` of the document on line `pad_line` of pad. The pad
+    // line is blank and the cursor is at its start when called.
+    using LineSource = std::function<void(Pad& pad, int pad_line, int line)>;
+
+    // band_lines is the number of lines kept in the pad. It defaults to three
+    // times the number of visible lines.
+    PadViewport(
+            SizeLinesCols view_size,
+            PosYx view_top_left,
+            int num_lines,
+            int cols,
+            LineSource source,
+            int band_lines = 0);
+
+    int GetNumLines() const { return num_lines_; }
+    void SetNumLines(int num_lines);
+
+    // Fetch all lines again on the next refresh
+    void Invalidate() { valid_ = false; }
+
+    // Fetch line again, if it is in the band
+    void InvalidateLine(int line);
+
+    // Top visible line, clamped so that the view stays within the document
+    int GetTop() const { return top_; }
+    void ScrollTo(int top);
+    void ScrollBy(int n) { ScrollTo(top_ + n); }
+
+    // Leftmost visible column
+    int GetLeft() const { return left_; }
+    void ScrollToCol(int left);
+
+    Result Refresh();
+    Result Noutrefresh();
+
+    const Pad& GetPad() const { return pad_; }
+    Pad& GetPad() { return pad_; }
+    int GetBandFirst() const { return band_first_; }
+
+    // Total number of lines fetched from the line source
+    long GetFetchCount() const { return fetch_count_; }
+
+private:
+    void Materialize();
+    void Fetch(int first, int count);
+    PosYx ScreenMax() const;
+
+    SizeLinesCols view_size_;
+    PosYx view_top_left_;
+    int num_lines_;
+    int cols_;
+    LineSource source_;
+    Pad pad_;
+    int band_lines_;
+    int band_first_ = 0;
+    int top_ = 0;
+    int left_ = 0;
+    bool valid_ = false;
+    long fetch_count_ = 0;
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,118 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/render_thread.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace curses
+{
+
+RenderThread::RenderThread(int max_fps) :
+    scheduler_{max_fps},
+    thread_{[this] { Run(); }}
+{}
+
+RenderThread::~RenderThread()
+{
+    Join();
+}
+
+void RenderThread::Post(Command command)
+{
+    queue_.Push(std::move(command));
+    // Pairs with the fence in WaitForCommand, so that either the render
+    // thread sees the command or this thread sees idle_
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_.load(std::memory_order_relaxed)) Wake();
+}
+
+void RenderThread::Stop()
+{
+    Join();
+    if (exception_) std::rethrow_exception(std::exchange(exception_, {}));
+}
+
+void RenderThread::Join()
+{
+    if (!IsRunning()) return;
+    stop_.store(true, std::memory_order_seq_cst);
+    Wake();
+    thread_.join();
+}
+
+void RenderThread::Run()
+{
+    const auto auto_endwin = Initscr();
+    auto next_frame = FrameScheduler::Clock::now();
+    while (!stop_.load(std::memory_order_acquire))
+    {
+        RunCommands();
+        scheduler_.Tick();
+        next_frame += scheduler_.GetFramePeriod();
+        // Don't try to catch up after a slow frame
+        next_frame = std::max(next_frame, FrameScheduler::Clock::now());
+        if (!scheduler_.IsPending()) WaitForCommand();
+        std::this_thread::sleep_until(next_frame);
+    }
+    RunCommands();
+    scheduler_.FlushNow();
+}
+
+void RenderThread::WaitForCommand()
+{
+    auto lock = std::unique_lock{idle_mutex_};
+    idle_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    idle_cv_.wait(lock, [this] { return stop_.load(std::memory_order_acquire) || !queue_.IsEmpty(); });
+    idle_.store(false, std::memory_order_relaxed);
+}
+
+void RenderThread::Wake()
+{
+    // Lock, so that the notification can't come between the check and the
+    // wait in WaitForCommand
+    {
+        const auto lock = std::lock_guard{idle_mutex_};
+    }
+    idle_cv_.notify_one();
+}
+
+void RenderThread::RunCommands()
+{
+    while (auto command = queue_.TryPop())
+    {
+        // Keep the first exception for Stop, so that the thread keeps
+        // running and Endwin is still called
+        try
+        {
+            (*command)();
+        }
+        catch (...)
+        {
+            if (!exception_) exception_ = std::current_exception();
+        }
+        command_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+} // namespace curses
@@ -0,0 +1,110 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_RENDER_THREAD_HPP_
+#define CURSES_CPP_RENDER_THREAD_HPP_
+
+#include "curses_cpp/frame_scheduler.hpp"
+#include "curses_cpp/mpsc_queue.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace curses
+{
+
+// RenderThread owns the curses screen on a dedicated thread. Since curses
+// is not thread-safe, other threads don't call curses functions directly.
+// Instead they post commands, which the render thread runs once per frame
+// before flushing the windows scheduled with GetScheduler().
+//
+// Post never waits for the render thread, so producers are not slowed down
+// by terminal output. While there are no commands and no scheduled windows,
+// the render thread sleeps until the next Post or Stop.
+//
+// Example:
+//
+//     auto render = RenderThread{};
+//     auto pane = std::optional<Window>{};
+//     render.Post([&] { pane.emplace(SizeLinesCols{1, 20}, PosYx{}); });
+//     ...
+//     render.Post([&, n] { pane->Addstr({0, 0}, std::to_string(n)); render.GetScheduler().Schedule(*pane); });
+class RenderThread
+{
+public:
+    using Command = std::function<void()>;
+
+    // Start the render thread, which calls Initscr
+    explicit RenderThread(int max_fps = 60);
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+    RenderThread(RenderThread&&) = delete;
+    RenderThread& operator=(RenderThread&&) = delete;
+
+    // Stop unless already stopped. An exception from a command is dropped.
+    ~RenderThread();
+
+    // Queue a command to run on the render thread. May be called from any
+    // thread, including the render thread.
+    void Post(Command command);
+
+    // Run the remaining commands, flush the scheduled windows, call Endwin
+    // and join the render thread. Commands posted after Stop are not run.
+    // Does nothing if already stopped.
+    //
+    // If a command throws, the render thread goes on with the next command,
+    // and Stop rethrows the first exception after joining the thread.
+    void Stop();
+
+    bool IsRunning() const { return thread_.joinable(); }
+
+    // Only to be used on the render thread, i.e. in commands
+    FrameScheduler& GetScheduler() { return scheduler_; }
+
+    // Number of commands run so far
+    long GetCommandCount() const { return command_count_.load(std::memory_order_relaxed); }
+
+private:
+    void Join();
+    void Run();
+    void RunCommands();
+    void WaitForCommand();
+    void Wake();
+
+    FrameScheduler scheduler_;
+    MpscQueue<Command> queue_;
+    std::atomic<bool> stop_{false};
+    std::atomic<bool> idle_{false};    // Render thread is in WaitForCommand
+    std::mutex idle_mutex_;
+    std::condition_variable idle_cv_;
+    std::atomic<long> command_count_{0};
+    std::exception_ptr exception_;     // Written by the render thread, read after joining
+    std::thread thread_;    // Last, so that it starts after the other members are initialized
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,96 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/resize_coordinator.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace curses
+{
+
+ResizeCoordinator::Placement ResizeCoordinator::Fill(int top, int left, int bottom, int right)
+{
+    return [=] (SizeLinesCols term)
+    {
+        const auto lines = std::max(term.lines - top - bottom, 1);
+        const auto cols = std::max(term.cols - left - right, 1);
+        return Geometry{{lines, cols}, {top, left}};
+    };
+}
+
+void ResizeCoordinator::Add(Window& window, Placement placement, Redraw redraw)
+{
+    assert(window.Get() && !window.IsSubwin());
+    const auto [lines, cols] = window.Getmaxyx();
+    entries_.push_back({&window, std::move(placement), std::move(redraw), {lines, cols}});
+}
+
+void ResizeCoordinator::Remove(const Window& window)
+{
+    const auto it = std::find_if(
+            entries_.begin(), entries_.end(),
+            [&] (const Entry& entry) { return entry.window == &window; });
+    if (it != entries_.end()) entries_.erase(it);
+}
+
+Result ResizeCoordinator::Update()
+{
+    exposed_cells_ = 0;
+    const auto term = SizeLinesCols{Lines(), Cols()};
+    auto ok = true;
+    for (auto& entry : entries_)
+    {
+        auto& window = *entry.window;
+        const auto [lines_cols, top_left] = entry.placement(term);
+        // Resize before moving, since Mvwin fails if the window doesn't fit
+        // on the screen with its current size
+        const auto [cur_lines, cur_cols] = window.Getmaxyx();
+        if (lines_cols != SizeLinesCols{cur_lines, cur_cols}) ok = window.Resize(lines_cols) == Result::Ok && ok;
+        if (top_left != window.Getbegyx()) ok = window.Mvwin(top_left) == Result::Ok && ok;
+
+        // Compare to the size at the previous update, since ncurses may
+        // already have resized the window in resizeterm
+        const auto [lines, cols] = window.Getmaxyx();
+        const auto before = entry.lines_cols;
+        entry.lines_cols = {lines, cols};
+        if (lines > before.lines) Expose(entry, {{before.lines, 0}, {lines - 1, cols - 1}});
+        if (cols > before.cols) Expose(entry, {{0, before.cols}, {std::min(before.lines, lines) - 1, cols - 1}});
+    }
+    return ok ? Result::Ok : Result::Err;
+}
+
+Result ResizeCoordinator::Resize(SizeLinesCols term)
+{
+    const auto res = Resizeterm(term);
+    if (res != Result::Ok) return res;
+    return Update();
+}
+
+void ResizeCoordinator::Expose(Entry& entry, RectMinMax rect)
+{
+    if (rect.min.y > rect.max.y || rect.min.x > rect.max.x) return;
+    exposed_cells_ += static_cast<long>(rect.max.y - rect.min.y + 1) * (rect.max.x - rect.min.x + 1);
+    if (entry.redraw) entry.redraw(*entry.window, rect);
+}
+
+} // namespace curses
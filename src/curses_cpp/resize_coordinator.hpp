@@ -0,0 +1,92 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_RESIZE_COORDINATOR_HPP_
+#define CURSES_CPP_RESIZE_COORDINATOR_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <functional>
+#include <vector>
+
+namespace curses
+{
+
+// ResizeCoordinator keeps a set of windows in place when the terminal is
+// resized. Instead of recreating the windows, each one is resized with
+// Window::Resize and moved with Window::Mvwin, so cells that remain visible
+// keep their contents and subwindows and their parent links stay valid.
+// Only the newly exposed parts of each window are passed to its redraw
+// callback.
+//
+// Add top-level windows only. Subwindows follow their parents, see
+// Window::Resize.
+class ResizeCoordinator
+{
+public:
+    struct Geometry
+    {
+        SizeLinesCols lines_cols;
+        PosYx top_left;
+    };
+
+    // Compute the geometry of a window for a terminal size
+    using Placement = std::function<Geometry(SizeLinesCols term)>;
+
+    // Draw the newly exposed part rect of window, in window coordinates
+    using Redraw = std::function<void(Window& window, RectMinMax rect)>;
+
+    // Place a window over the terminal minus the given margins
+    static Placement Fill(int top = 0, int left = 0, int bottom = 0, int right = 0);
+
+    // window must outlive the coordinator or be removed. The current size of
+    // the window is taken as its previous size on the next Update.
+    void Add(Window& window, Placement placement, Redraw redraw = {});
+    void Remove(const Window& window);
+
+    // Place the windows for the current terminal size, e.g. after getting
+    // Key::Resize, at which point ncurses has already resized the terminal
+    Result Update();
+
+    // Resize the terminal with Resizeterm and place the windows
+    Result Resize(SizeLinesCols term);
+
+    // Number of cells passed to redraw callbacks in the last Update
+    long GetExposedCells() const { return exposed_cells_; }
+
+private:
+    struct Entry
+    {
+        Window* window;
+        Placement placement;
+        Redraw redraw;
+        SizeLinesCols lines_cols;
+    };
+
+    void Expose(Entry& entry, RectMinMax rect);
+
+    std::vector<Entry> entries_;
+    long exposed_cells_ = 0;
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,161 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_STYLED_TEXT_HPP_
+#define CURSES_CPP_STYLED_TEXT_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace curses
+{
+
+namespace detail
+{
+
+constexpr int ParseMarkupInt(std::string_view str)
+{
+    if (str.empty() || str.size() > 3) ConstexprError("Invalid number in markup tag");
+    auto value = 0;
+    for (const auto c : str)
+    {
+        if (c < '0' || '9' < c) ConstexprError("Invalid number in markup tag");
+        value = 10 * value + (c - '0');
+    }
+    return value;
+}
+
+// Return the attribute for a tag name, e.g. "bold" or "pair=3"
+constexpr Attr ParseMarkupTag(std::string_view name)
+{
+    if (name == "b" || name == "bold") return Attr::Bold;
+    if (name == "u" || name == "underline") return Attr::Underline;
+    if (name == "r" || name == "reverse") return Attr::Reverse;
+    if (name == "dim") return Attr::Dim;
+    if (name == "blink") return Attr::Blink;
+    if (name == "standout") return Attr::Standout;
+    if (name == "invis") return Attr::Invis;
+    if (name == "alt") return Attr::Altcharset;
+    constexpr auto pair_prefix = std::string_view{"pair="};
+    if (name.substr(0, pair_prefix.size()) == pair_prefix)
+    {
+        const auto pair_number = ParseMarkupInt(name.substr(pair_prefix.size()));
+        if (pair_number > 255) ConstexprError("Color pair out of range in markup tag");
+        return ColorPair(pair_number);
+    }
+    ConstexprError("Unknown markup tag");
+}
+
+// Return the name of a tag without any argument, e.g. "pair" for "pair=3"
+constexpr std::string_view MarkupTagKey(std::string_view name)
+{
+    return name.substr(0, name.find('='));
+}
+
+} // namespace detail
+
+// Text with per-character attributes, typically created at compile time with
+// Markup and drawn with a single Window::Addchstr. Holds at most N cells.
+template<std::size_t N>
+class StyledText
+{
+public:
+    constexpr int Size() const { return size_; }
+    constexpr const Chtype* Data() const { return cells_.data(); }
+    constexpr const std::array<Chtype, N>& Cells() const { return cells_; }
+
+    constexpr std::basic_string_view<Chtype> View() const
+    {
+        return {cells_.data(), static_cast<std::size_t>(size_)};
+    }
+
+    constexpr operator std::basic_string_view<Chtype>() const { return View(); } // NOLINT: Allow implicit conversion
+
+    constexpr void PushBack(Chtype ch)
+    {
+        cells_[static_cast<std::size_t>(size_++)] = ch;
+    }
+
+private:
+    std::array<Chtype, N> cells_{};
+    int size_ = 0;
+};
+
+// Parse text with style tags into a StyledText, e.g.
+//
+//     constexpr auto label = Markup("CPU: [b]42%[/b] [pair=2]ok[/pair]");
+//     window.Addchstr({0, 0}, label);
+//
+// Tags are b/bold, u/underline, r/reverse, dim, blink, standout, invis, alt
+// (the alternate character set) and pair=N (color pair N). Every tag must be
+// closed with [/name], in reverse order of opening, and closing a tag
+// restores the attributes that were in effect before it was opened. Use [[
+// for a literal [.
+//
+// Declare the result constexpr to parse the markup at compile time. Then
+// invalid markup is a compile error.
+template<std::size_t N>
+constexpr StyledText<N - 1> Markup(const char (&str)[N])
+{
+    constexpr auto MaxDepth = 16;
+    const auto text = std::string_view{str, N - 1};
+    auto ret = StyledText<N - 1>{};
+    auto attrs = std::array<Attr, MaxDepth + 1>{};
+    auto keys = std::array<std::string_view, MaxDepth + 1>{};
+    auto depth = 0;
+    std::size_t i = 0;
+    while (i < text.size())
+    {
+        const auto c = text[i];
+        if (c != '[' || (i + 1 < text.size() && text[i + 1] == '['))
+        {
+            ret.PushBack(Chtype{static_cast<unsigned char>(c) | static_cast<unsigned>(attrs[depth])});
+            i += c == '[' ? 2 : 1;
+            continue;
+        }
+        const auto end = text.find(']', i);
+        if (end == std::string_view::npos) detail::ConstexprError("Unterminated markup tag");
+        const auto tag = text.substr(i + 1, end - i - 1);
+        i = end + 1;
+        if (!tag.empty() && tag[0] == '/')
+        {
+            if (depth == 0 || keys[depth] != tag.substr(1)) detail::ConstexprError("Mismatched closing markup tag");
+            --depth;
+            continue;
+        }
+        if (depth == MaxDepth) detail::ConstexprError("Markup tags nested too deep");
+        const auto attr = detail::ParseMarkupTag(tag);
+        // A color pair replaces the current one instead of being combined
+        const auto base = (attr & static_cast<Attr>(detail::ColorMask)) != Attr::Normal ? RemoveColor(attrs[depth]) : attrs[depth];
+        ++depth;
+        attrs[depth] = base | attr;
+        keys[depth] = detail::MarkupTagKey(tag);
+    }
+    if (depth != 0) detail::ConstexprError("Unclosed markup tag");
+    return ret;
+}
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,153 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/window_pool.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace curses
+{
+
+namespace
+{
+
+int RoundUpToPowerOfTwo(int n)
+{
+    auto ret = 1;
+    while (ret < n) ret *= 2;
+    return ret;
+}
+
+// Reset the state that popups typically change
+bool Reset(Window& window, SizeLinesCols lines_cols, PosYx top_left)
+{
+    const auto [lines, cols] = window.Getmaxyx();
+    if (lines_cols != SizeLinesCols{lines, cols} && window.Resize(lines_cols) != Result::Ok) return false;
+    if (window.Getbegyx() != top_left && window.Mvwin(top_left) != Result::Ok) return false;
+    window.Attrset(Attr::Normal);
+    window.Bkgdset(' ');
+    window.Scrollok(false);
+    window.Keypad(false);
+    window.Nodelay(false);
+    window.Leaveok(false);
+    window.TrackDamage(false);
+    window.Erase();
+    window.Move({0, 0});
+    return true;
+}
+
+} // namespace
+
+WindowPool::Lease::Lease(Lease&& other) noexcept :
+    pool_{other.pool_},
+    window_{std::move(other.window_)}
+{
+    other.pool_ = nullptr;
+}
+
+WindowPool::Lease& WindowPool::Lease::operator=(Lease&& other) noexcept
+{
+    Release();
+    pool_ = other.pool_;
+    window_ = std::move(other.window_);
+    other.pool_ = nullptr;
+    return *this;
+}
+
+void WindowPool::Lease::Release()
+{
+    if (pool_ && window_.Get()) pool_->Return(std::move(window_));
+    pool_ = nullptr;
+    window_ = Window{};
+}
+
+void WindowPool::Reserve(SizeLinesCols lines_cols, int count)
+{
+    const auto class_size = GetSizeClass(lines_cols);
+    auto& size_class = FindSizeClass(class_size);
+    while (static_cast<int>(size_class.free.size()) < count)
+    {
+        size_class.free.emplace_back(class_size);
+        ++stats_.allocated;
+    }
+}
+
+WindowPool::Lease WindowPool::Acquire(SizeLinesCols lines_cols, PosYx top_left)
+{
+    assert(lines_cols.lines > 0 && lines_cols.cols > 0);
+    ++stats_.acquired;
+    auto& size_class = FindSizeClass(GetSizeClass(lines_cols));
+    while (!size_class.free.empty())
+    {
+        auto window = std::move(size_class.free.back());
+        size_class.free.pop_back();
+        if (Reset(window, lines_cols, top_left))
+        {
+            ++stats_.reused;
+            return {this, std::move(window)};
+        }
+    }
+    auto window = Window{lines_cols, top_left};
+    ++stats_.allocated;
+    return {this, std::move(window)};
+}
+
+int WindowPool::GetNumFree() const
+{
+    auto ret = 0;
+    for (const auto& size_class : classes_) ret += static_cast<int>(size_class.free.size());
+    return ret;
+}
+
+SizeLinesCols WindowPool::GetSizeClass(SizeLinesCols lines_cols)
+{
+    return {RoundUpToPowerOfTwo(lines_cols.lines), RoundUpToPowerOfTwo(lines_cols.cols)};
+}
+
+WindowPool::SizeClass& WindowPool::FindSizeClass(SizeLinesCols class_size)
+{
+    auto it = std::find_if(
+            classes_.begin(), classes_.end(),
+            [&] (const SizeClass& size_class) { return size_class.lines_cols == class_size; });
+    if (it != classes_.end()) return *it;
+    auto& size_class = classes_.emplace_back();
+    size_class.lines_cols = class_size;
+    size_class.free.reserve(max_free_per_class_);
+    return size_class;
+}
+
+void WindowPool::Return(Window&& window)
+{
+    assert(!window.IsSubwin());
+    const auto [lines, cols] = window.Getmaxyx();
+    auto& size_class = FindSizeClass(GetSizeClass({lines, cols}));
+    if (static_cast<int>(size_class.free.size()) >= max_free_per_class_)
+    {
+        ++stats_.dropped;
+        window = Window{};
+        return;
+    }
+    size_class.free.push_back(std::move(window));
+}
+
+} // namespace curses
@@ -0,0 +1,112 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#ifndef CURSES_CPP_WINDOW_POOL_HPP_
+#define CURSES_CPP_WINDOW_POOL_HPP_
+
+#include "curses_cpp/curses.hpp"
+
+#include <vector>
+
+namespace curses
+{
+
+// WindowPool hands out windows for short-lived popups and tooltips without
+// a newwin/delwin pair for each one. Released windows are kept in free
+// lists by size class (lines and columns rounded up to powers of two), and
+// are reset with Window::Resize, Window::Mvwin and Window::Erase when handed
+// out again.
+//
+// The pool must outlive its leases.
+class WindowPool
+{
+public:
+    // Window on loan from a pool. Returns the window to the pool when
+    // destroyed or released.
+    class Lease
+    {
+    public:
+        Lease() = default;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        ~Lease() { Release(); }
+
+        explicit operator bool() const { return window_.Get() != nullptr; }
+        Window& operator*() { return window_; }
+        Window* operator->() { return &window_; }
+        Window& Get() { return window_; }
+
+        void Release();
+
+    private:
+        friend class WindowPool;
+
+        Lease(WindowPool* pool, Window&& window) : pool_{pool}, window_{std::move(window)} {}
+
+        WindowPool* pool_ = nullptr;
+        Window window_;
+    };
+
+    struct Stats
+    {
+        long acquired = 0;
+        long reused = 0;
+        long allocated = 0;
+        long dropped = 0;  // Released when the free list was full
+    };
+
+    // At most max_free_per_class released windows are kept per size class
+    explicit WindowPool(int max_free_per_class = 8) : max_free_per_class_{max_free_per_class} {}
+
+    WindowPool(const WindowPool&) = delete;
+    WindowPool& operator=(const WindowPool&) = delete;
+
+    // Allocate count windows of the size class of lines_cols up front
+    void Reserve(SizeLinesCols lines_cols, int count);
+
+    // Hand out a blank window with normal attributes. Throws
+    // std::runtime_error if the window doesn't fit on the screen.
+    Lease Acquire(SizeLinesCols lines_cols, PosYx top_left = {});
+
+    int GetNumFree() const;
+    const Stats& GetStats() const { return stats_; }
+
+private:
+    struct SizeClass
+    {
+        SizeLinesCols lines_cols;
+        std::vector<Window> free;
+    };
+
+    static SizeLinesCols GetSizeClass(SizeLinesCols lines_cols);
+    SizeClass& FindSizeClass(SizeLinesCols lines_cols);
+    void Return(Window&& window);
+
+    int max_free_per_class_;
+    std::vector<SizeClass> classes_;
+    Stats stats_{};
+};
+
+} // namespace curses
+
+#endif // Include guard
@@ -0,0 +1,76 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/window_snapshot.hpp"
+
+#include <curses.h>
+
+#include <cassert>
+
+namespace curses
+{
+
+void Window::Snapshot(WindowSnapshot& snapshot)
+{
+    static_assert(sizeof(Chtype) == sizeof(chtype), "no padding in Chtype");
+    auto* window = Get();
+    assert(window);
+    const auto [lines, cols] = Getmaxyx();
+    snapshot.cursor = Getyx();
+    if (snapshot.cells.GetSize() != SizeLinesCols{lines, cols})
+    {
+        snapshot.cells.Resize({lines, cols});
+    }
+    if (lines == 0 || cols == 0) return;
+
+    // winchnstr writes a trailing null after the n elements it reads. Reading
+    // the rows in order, it lands on the first element of the next row,
+    // which is overwritten next. The last element of the last row is read
+    // separately to not write past the end.
+    auto* data = reinterpret_cast<chtype*>(snapshot.cells.Data());
+    for (int y = 0; y < lines - 1; ++y)
+    {
+        mvwinchnstr(window, y, 0, data + static_cast<std::size_t>(y) * cols, cols);
+    }
+    auto* last_row = data + static_cast<std::size_t>(lines - 1) * cols;
+    if (cols > 1) mvwinchnstr(window, lines - 1, 0, last_row, cols - 1);
+    last_row[cols - 1] = mvwinch(window, lines - 1, cols - 1);
+
+    wmove(window, snapshot.cursor.y, snapshot.cursor.x);
+}
+
+WindowSnapshot Window::Snapshot()
+{
+    auto ret = WindowSnapshot{};
+    Snapshot(ret);
+    return ret;
+}
+
+Result Window::Restore(const WindowSnapshot& snapshot)
+{
+    const auto res = snapshot.cells.Commit(*this);
+    const auto [lines, cols] = Getmaxyx();
+    const auto cursor = snapshot.cursor;
+    if (cursor.y < lines && cursor.x < cols) Move(cursor);
+    return res;
+}
+
+} // namespace curses
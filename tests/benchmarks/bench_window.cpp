@@ -0,0 +1,121 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+// Per-call overhead of the Window wrappers compared to calling ncurses
+// directly. Build with and without CURSES_CPP_INLINE to compare the two
+// modes. Runs in the terminal but doesn't refresh the screen.
+#include "curses_cpp/curses.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <curses.h>
+
+using namespace curses;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct BenchResult
+{
+    std::string name;
+    double ns_per_call = 0;
+};
+
+// Call fn(y, x) for each cell of a lines x cols window, reps times, and
+// return the time per call in ns
+template<typename Fn>
+double Measure(int lines, int cols, int reps, Fn&& fn)
+{
+    const auto start = Clock::now();
+    for (int r = 0; r < reps; ++r)
+    {
+        for (int y = 0; y < lines; ++y)
+        {
+            for (int x = 0; x < cols; ++x) fn(y, x);
+        }
+    }
+    const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start);
+    return elapsed.count() / (static_cast<double>(reps) * lines * cols);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const auto reps = argc > 1 ? std::atoi(argv[1]) : 1000;
+
+    auto results = std::vector<BenchResult>{};
+    auto sink = 0U;
+    {
+        const auto _ = Initscr();
+        auto window = Window({}, {});
+        auto* raw = window.Get();
+        const auto [lines, cols] = window.Getmaxyx();
+        const auto ch = Chtype{'x', Attr::Bold};
+
+        results.push_back({"mvwaddch", Measure(lines, cols, reps, [&] (int y, int x) {
+            mvwaddch(raw, y, x, ch.Get());
+        })});
+        results.push_back({"Window::Addch(yx)", Measure(lines, cols, reps, [&] (int y, int x) {
+            window.Addch({y, x}, ch);
+        })});
+        results.push_back({"wmove + waddch", Measure(lines, cols, reps, [&] (int y, int x) {
+            wmove(raw, y, x);
+            waddch(raw, ch.Get());
+        })});
+        results.push_back({"Window::Move + Addch", Measure(lines, cols, reps, [&] (int y, int x) {
+            window.Move({y, x});
+            window.Addch(ch);
+        })});
+        results.push_back({"mvwinch", Measure(lines, cols, reps, [&] (int y, int x) {
+            sink += static_cast<unsigned>(mvwinch(raw, y, x));
+        })});
+        results.push_back({"Window::Inch(yx)", Measure(lines, cols, reps, [&] (int y, int x) {
+            sink += window.Inch({y, x}).Get();
+        })});
+        results.push_back({"wattron + wattroff", Measure(lines, cols, reps, [&] (int, int) {
+            wattron(raw, A_BOLD);
+            wattroff(raw, A_BOLD);
+        })});
+        results.push_back({"Window::Attron + Attroff", Measure(lines, cols, reps, [&] (int, int) {
+            window.Attron(Attr::Bold);
+            window.Attroff(Attr::Bold);
+        })});
+    }
+
+#if defined(CURSES_CPP_INLINE)
+    std::printf("CURSES_CPP_INLINE: on\n");
+#else
+    std::printf("CURSES_CPP_INLINE: off\n");
+#endif
+    for (const auto& result : results)
+    {
+        std::printf("%-28s %8.2f ns/call\n", result.name.c_str(), result.ns_per_call);
+    }
+    std::printf("(checksum %u)\n", sink);
+    return 0;
+}
@@ -0,0 +1,66 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/bracketed_paste.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+using namespace curses;
+
+TEST_CASE("BracketedPaste")
+{
+    const auto _ = Initscr();
+    auto window = Window({}, {});
+    window.Keypad();
+    Flushinp();
+
+    auto begin_key = 0;
+    {
+        const auto paste = BracketedPaste{};
+        begin_key = paste.GetBeginKey();
+        REQUIRE(begin_key > Key::Resize);
+        REQUIRE(paste.GetEndKey() != begin_key);
+        REQUIRE(KeyDefined("\033[200~") == begin_key);
+        REQUIRE(KeyDefined("\033[201~") == paste.GetEndKey());
+
+        // Keys are returned in reverse order of Ungetch
+        const auto text = std::string{"key = value\r\xc3\xa5"};
+        Ungetch('x');
+        Ungetch(paste.GetEndKey());
+        for (auto it = text.rbegin(); it != text.rend(); ++it) Ungetch(static_cast<unsigned char>(*it));
+        Ungetch(Key::F0 + 1);
+        Ungetch(begin_key);
+
+        REQUIRE(window.Getch() == begin_key);
+        REQUIRE(paste.ReadPaste(window) == text);
+        REQUIRE(window.Getch() == 'x');
+
+        // Missing end marker
+        window.Timeout(-1);
+        Ungetch('y');
+        REQUIRE(paste.ReadPaste(window, 0) == "y");
+        REQUIRE(window.Getdelay() == -1);
+    }
+    REQUIRE(KeyDefined("\033[200~") == 0);
+    REQUIRE(Keybound(begin_key) == std::nullopt);
+}
@@ -0,0 +1,86 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/cell_grid.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string>
+
+using namespace curses;
+
+static bool RowEquals(const CellGrid& grid, int y, const std::basic_string<Chtype>& expected)
+{
+    const auto row = grid.RowView(y);
+    return std::equal(row.begin(), row.end(), expected.begin(), expected.end());
+}
+
+TEST_CASE("CellGrid: Construction")
+{
+    const auto grid = CellGrid{{2, 3}, 'x'};
+    REQUIRE(grid.GetSize() == SizeLinesCols{2, 3});
+    REQUIRE(RowEquals(grid, 1, std::basic_string<Chtype>(3, 'x')));
+    REQUIRE(grid.Contains({1, 2}));
+    REQUIRE(!grid.Contains({2, 0}));
+    REQUIRE(!grid.Contains({0, -1}));
+}
+
+TEST_CASE("CellGrid: Put, FillRect")
+{
+    auto grid = CellGrid{{2, 4}};
+
+    REQUIRE(grid.Put({0, 1}, "abcdef", Attr::Bold) == 3);
+    REQUIRE(grid[{0, 0}] == ' ');
+    REQUIRE(grid[{0, 1}] == ('a' | Attr::Bold));
+    REQUIRE(grid[{0, 3}] == ('c' | Attr::Bold));
+
+    REQUIRE(grid.Put({1, -2}, "abc") == 1);
+    REQUIRE(grid[{1, 0}] == 'c');
+    REQUIRE(grid.Put({2, 0}, "abc") == 0);
+
+    const auto chstr = std::basic_string<Chtype>{'X', 'Y'};
+    REQUIRE(grid.Put({1, 3}, chstr) == 1);
+    REQUIRE(grid[{1, 3}] == 'X');
+
+    grid.FillRect({-1, 2}, {5, 5}, '#');
+    REQUIRE(RowEquals(grid, 0, std::basic_string<Chtype>{' ', 'a' | Attr::Bold, '#', '#'}));
+    REQUIRE(RowEquals(grid, 1, std::basic_string<Chtype>{'c', ' ', '#', '#'}));
+
+    grid.Fill('.');
+    REQUIRE(RowEquals(grid, 0, std::basic_string<Chtype>(4, '.')));
+}
+
+TEST_CASE("CellGrid: Commit")
+{
+    const auto _ = Initscr();
+    auto window = Window{{3, 6}, {}};
+
+    auto grid = CellGrid{{4, 3}, '.'};
+    grid.Put({0, 0}, "ABC", Attr::Reverse);
+    grid.Put({1, 0}, "DEF");
+
+    REQUIRE(Result::Ok == grid.Commit(window, {1, 2}));
+    REQUIRE(window.Instr({0, 0}) == "      ");
+    REQUIRE(window.Instr({1, 0}) == "  ABC ");
+    REQUIRE(window.Instr({2, 0}) == "  DEF ");
+    REQUIRE(window.Inch({1, 2}) == ('A' | Attr::Reverse));
+}
@@ -0,0 +1,180 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/coroutine.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+using namespace curses;
+
+namespace
+{
+
+Task ReadWord(TaskScheduler& scheduler, std::string& word)
+{
+    while (true)
+    {
+        const auto key = co_await scheduler.NextKey();
+        if (key == ' ') co_return;
+        word += static_cast<char>(key);
+    }
+}
+
+Task CountKeys(TaskScheduler& scheduler, int& count)
+{
+    while (true)
+    {
+        co_await scheduler.NextKey();
+        ++count;
+    }
+}
+
+Task WaitForClick(TaskScheduler& scheduler, Mevent& event)
+{
+    event = co_await scheduler.NextMouse(Mmask::Button1Clicked);
+}
+
+Task SleepTwice(TaskScheduler& scheduler, int& wakeups)
+{
+    co_await scheduler.Sleep(std::chrono::milliseconds{5});
+    ++wakeups;
+    co_await scheduler.Sleep(std::chrono::milliseconds{5});
+    ++wakeups;
+}
+
+Task Throw(TaskScheduler& scheduler)
+{
+    co_await scheduler.NextKey();
+    throw std::runtime_error{"task failed"};
+}
+
+} // namespace
+
+TEST_CASE("TaskScheduler")
+{
+    const auto _ = Initscr();
+    Raw();
+    Flushinp();
+    auto window = Window({}, {});
+    window.Keypad();
+    auto scheduler = TaskScheduler{window};
+
+    SECTION("Keys")
+    {
+        auto word = std::string{};
+        auto count = 0;
+        scheduler.Spawn(ReadWord(scheduler, word));
+        scheduler.Spawn(CountKeys(scheduler, count));
+        REQUIRE(scheduler.GetNumTasks() == 2);
+
+        for (const auto ch : std::string{" ab"}) Ungetch(ch);  // Read in reverse order
+        REQUIRE(scheduler.RunOnce(0) == 1);
+        REQUIRE(word == "ba");
+        REQUIRE(count == 3);
+
+        REQUIRE(scheduler.RunOnce(0) == 1);
+        REQUIRE(count == 3);
+    }
+
+    SECTION("Keys are queued while no task waits")
+    {
+        Ungetch('y');
+        Ungetch('x');
+        REQUIRE(scheduler.RunOnce(0) == 0);
+
+        auto word = std::string{};
+        scheduler.Spawn(ReadWord(scheduler, word));
+        REQUIRE(word == "xy");
+        REQUIRE(scheduler.GetNumTasks() == 1);
+    }
+
+    SECTION("Mouse")
+    {
+        Mousemask(Mmask::AllMouseEvents);
+        auto event = Mevent{};
+        auto count = 0;
+        scheduler.Spawn(WaitForClick(scheduler, event));
+        scheduler.Spawn(CountKeys(scheduler, count));
+
+        auto pressed = Mevent{};
+        pressed.bstate = Mmask::Button2Pressed;
+        REQUIRE(Ungetmouse(pressed) == Result::Ok);
+        REQUIRE(scheduler.RunOnce(0) == 2);
+
+        auto clicked = Mevent{};
+        clicked.y = 3;
+        clicked.x = 4;
+        clicked.bstate = Mmask::Button1Clicked;
+        REQUIRE(Ungetmouse(clicked) == Result::Ok);
+        REQUIRE(scheduler.RunOnce(0) == 1);
+        REQUIRE(event.Getyx() == PosYx{3, 4});
+        REQUIRE(count == 0);
+    }
+
+    SECTION("Sleep")
+    {
+        auto wakeups = 0;
+        scheduler.Spawn(SleepTwice(scheduler, wakeups));
+        REQUIRE(scheduler.RunOnce(0) == 1);
+        REQUIRE(wakeups == 0);
+
+        const auto start = TaskScheduler::Clock::now();
+        scheduler.Run();
+        REQUIRE(wakeups == 2);
+        REQUIRE(TaskScheduler::Clock::now() - start >= std::chrono::milliseconds{10});
+    }
+
+    SECTION("Exceptions are rethrown")
+    {
+        scheduler.Spawn(Throw(scheduler));
+        Ungetch('x');
+        REQUIRE_THROWS_AS(scheduler.RunOnce(0), std::runtime_error);
+        REQUIRE(scheduler.RunOnce(0) == 0);
+    }
+
+    SECTION("Other tasks are resumed when a task throws")
+    {
+        auto count = 0;
+        auto wakeups = 0;
+        scheduler.Spawn(Throw(scheduler));
+        scheduler.Spawn(CountKeys(scheduler, count));
+        scheduler.Spawn(Throw(scheduler));
+        scheduler.Spawn(SleepTwice(scheduler, wakeups));
+        Ungetch('y');
+        Ungetch('x');
+        REQUIRE_THROWS_AS(scheduler.RunOnce(0), std::runtime_error);
+        REQUIRE(count == 2);
+        REQUIRE(scheduler.GetNumTasks() == 2);
+
+        // The key waiters are still registered
+        Ungetch('z');
+        REQUIRE(scheduler.RunOnce(0) == 2);
+        REQUIRE(count == 3);
+    }
+}
+
+#endif // __cpp_impl_coroutine
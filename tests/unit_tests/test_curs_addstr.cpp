@@ -37,3 +37,23 @@ TEST_CASE("curs_addstr")
     REQUIRE(Result::Ok == window.Addstr("Once upon a midnight dreary, while I pondered, weak and weary,"));
     REQUIRE(Result::Ok == window.Addstr({2, 1}, std::string{"Over many a quaint and curious volume of forgotten lore--"}));
 }
+
+TEST_CASE("curs_addstr: With Attr")
+{
+    const auto _ = Initscr();
+    auto window = Window({2, 300}, {});
+
+    window.Move({1, 1});
+    REQUIRE(Result::Ok == window.Addstr("ab", Attr::Bold));
+    REQUIRE(window.Getyx() == PosYx{1, 1});
+    REQUIRE(window.Inch({1, 1}) == ('a' | Attr::Bold));
+    REQUIRE(window.Inch({1, 2}) == ('b' | Attr::Bold));
+
+    const auto long_str = std::string(400, 'x');
+    REQUIRE(Result::Ok == window.Addstr({0, 10}, long_str, Attr::Underline));
+    REQUIRE(window.Getyx() == PosYx{0, 10});
+    REQUIRE(window.Inch({0, 9}) == ' ');
+    REQUIRE(window.Inch({0, 10}) == ('x' | Attr::Underline));
+    REQUIRE(window.Inch({0, 299}) == ('x' | Attr::Underline));
+    REQUIRE(window.Inch({1, 0}) == ' ');
+}
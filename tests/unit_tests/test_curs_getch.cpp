@@ -23,6 +23,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <array>
+
 using namespace curses;
 
 TEST_CASE("HasKey")
@@ -56,3 +58,54 @@ TEST_CASE("Ungetch, Getch")
     REQUIRE(Result::Ok == Ungetch(Key::F1));
     REQUIRE(Key::F1 == window.Getch());
 }
+
+TEST_CASE("Window::GetchBatch")
+{
+    const auto _ = Initscr();
+    auto window = Window({}, {});
+    window.Keypad();
+    Flushinp();
+
+    auto keys = std::array<int, 4>{};
+    REQUIRE(0 == window.GetchBatch(keys.data(), static_cast<int>(keys.size())));
+    REQUIRE_FALSE(window.IsNodelay());
+
+    for (const auto key : {'a', 'b', 'c', 'd', 'e'}) REQUIRE(Result::Ok == Ungetch(key));
+    REQUIRE(4 == window.GetchBatch(keys.data(), static_cast<int>(keys.size())));
+    REQUIRE(keys == std::array<int, 4>{'e', 'd', 'c', 'b'});
+    REQUIRE(1 == window.GetchBatch(keys.data(), static_cast<int>(keys.size())));
+    REQUIRE(keys.at(0) == 'a');
+
+    window.Timeout(50);
+    REQUIRE(Result::Ok == Ungetch(Key::F1));
+    REQUIRE(1 == window.GetchBatch(keys.data(), static_cast<int>(keys.size())));
+    REQUIRE(keys.at(0) == Key::F1);
+    REQUIRE(window.Getdelay() == 50);
+
+    Mousemask(Mmask::AllMouseEvents);
+    auto mouse_events = std::array<Mevent, 4>{};
+    REQUIRE(Result::Ok == Ungetch('x'));
+    REQUIRE(Result::Ok == Ungetmouse({0, 3, 2, 0, Mmask::Button1Pressed}));
+    REQUIRE(2 == window.GetchBatch(keys.data(), mouse_events.data(), static_cast<int>(keys.size())));
+    REQUIRE(keys.at(0) == Key::Mouse);
+    REQUIRE(mouse_events.at(0).Getyx() == PosYx{2, 3});
+    REQUIRE(mouse_events.at(0).bstate == Mmask::Button1Pressed);
+    REQUIRE(keys.at(1) == 'x');
+}
+
+TEST_CASE("DefineKey, KeyDefined, Keybound")
+{
+    const auto _ = Initscr();
+    const auto keycode = Key::Resize + 0100;
+    REQUIRE(KeyDefined("\033[9999~") == 0);
+    REQUIRE(Keybound(keycode) == std::nullopt);
+
+    REQUIRE(Result::Ok == DefineKey("\033[9999~", keycode));
+    REQUIRE(KeyDefined("\033[9999~") == keycode);
+    REQUIRE(KeyDefined("\033[9999") == -1);
+    REQUIRE(Keybound(keycode) == "\033[9999~");
+    REQUIRE(Keybound(keycode, 1) == std::nullopt);
+
+    REQUIRE(Result::Ok == DefineKey(nullptr, keycode));
+    REQUIRE(KeyDefined("\033[9999~") == 0);
+}
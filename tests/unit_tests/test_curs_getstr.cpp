@@ -24,6 +24,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <algorithm>
+#include <array>
 #include <string>
 
 using namespace curses;
@@ -56,3 +57,30 @@ TEST_CASE("curs_getstr")
     user();
     REQUIRE(window.Getstr({2, 3}, 4) == "0123");
 }
+
+TEST_CASE("curs_getstr: Caller buffer")
+{
+    const auto _ = Initscr();
+    Cbreak();
+    auto window = Window({}, {});
+
+    const auto user_input = std::string{"0123456"};
+    const auto user = [&] ()
+    {
+        Ungetch('\n');
+        std::for_each(
+                user_input.rbegin(),
+                user_input.rend(),
+                [] (char c) { Ungetch(c); });
+    };
+
+    auto buf = std::array<char, 16>{};
+
+    user();
+    REQUIRE(window.Getstr(buf.data(), static_cast<int>(buf.size())) == 7);
+    REQUIRE(std::string{buf.data()} == "0123456");
+
+    user();
+    REQUIRE(window.Getstr({2, 3}, buf.data(), 5) == 4);
+    REQUIRE(std::string{buf.data()} == "0123");
+}
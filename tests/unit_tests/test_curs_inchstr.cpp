@@ -24,6 +24,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <algorithm>
+#include <array>
 #include <string>
 
 using namespace curses;
@@ -51,3 +52,27 @@ TEST_CASE("curs_inchstr")
     REQUIRE(str.size() <= str1.size());
     REQUIRE(std::equal(str.begin(), str.end(), str1.begin()));
 }
+
+TEST_CASE("curs_inchstr: Caller buffer")
+{
+    const auto str = std::basic_string<Chtype>
+    {
+        'A' | Attr::Bold,
+        'B' | Attr::Reverse,
+        'C' | Attr::Normal,
+    };
+
+    const auto _ = Initscr();
+    auto window = Window({1, 3}, {});
+    window.Addchstr({0, 0}, str);
+
+    auto buf = std::array<Chtype, 8>{};
+    REQUIRE(window.Inchstr({0, 0}, buf.data(), static_cast<int>(buf.size())) == 3);
+    REQUIRE(std::equal(str.begin(), str.end(), buf.begin()));
+
+    window.Move({0, 1});
+    REQUIRE(window.Inchstr(buf.data(), 2) == 1);
+    REQUIRE(buf.at(0) == str.at(1));
+
+    REQUIRE(window.Inchstr({5, 0}, buf.data(), static_cast<int>(buf.size())) == 0);
+}
@@ -42,6 +42,12 @@ TEST_CASE("curs_inopts: Free functions")
     REQUIRE(Result::Err == Halfdelay(-1));
     REQUIRE(Result::Ok == Typeahead(-1));
     REQUIRE(Result::Ok == Meta());
+
+    const auto escdelay = GetEscdelay();
+    REQUIRE(Result::Ok == SetEscdelay(25));
+    REQUIRE(GetEscdelay() == 25);
+    REQUIRE(Result::Err == SetEscdelay(-1));
+    REQUIRE(Result::Ok == SetEscdelay(escdelay));
 }
 
 TEST_CASE("curs_inopts: Window methods")
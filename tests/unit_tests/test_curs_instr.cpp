@@ -24,6 +24,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <algorithm>
+#include <array>
 #include <string>
 
 using namespace curses;
@@ -45,3 +46,23 @@ TEST_CASE("Instr")
     REQUIRE(str.size() <= str1.size());
     REQUIRE(std::equal(str.begin(), str.end(), str1.begin()));
 }
+
+TEST_CASE("Instr: Caller buffer")
+{
+    const auto _ = Initscr();
+    auto window = Window({1, 8}, {});
+    window.Addstr({0, 0}, "001122");
+
+    auto buf = std::array<char, 5>{};
+    REQUIRE(window.Instr({0, 0}, buf.data(), static_cast<int>(buf.size())) == 4);
+    REQUIRE(std::string{buf.data()} == "0011");
+
+    REQUIRE(window.Instr({0, 4}, buf.data(), static_cast<int>(buf.size())) == 4);
+    REQUIRE(std::string{buf.data()} == "22  ");
+
+    window.Move({0, 2});
+    REQUIRE(window.Instr(buf.data(), 3) == 2);
+    REQUIRE(std::string{buf.data()} == "11");
+
+    REQUIRE(window.Instr({5, 0}, buf.data(), static_cast<int>(buf.size())) == 0);
+}
@@ -0,0 +1,49 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/curses.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace curses;
+
+TEST_CASE("curs_pad")
+{
+    const auto _ = Initscr();
+    REQUIRE(Lines() >= 3);
+    REQUIRE(Cols() >= 10);
+
+    auto pad = Pad{{1000, 200}};
+    REQUIRE(pad.IsPad());
+    REQUIRE(pad.Getmaxyx() == PosYx{1000, 200});
+
+    pad.Addstr({500, 100}, "pad");
+    REQUIRE(Result::Ok == pad.Pnoutrefresh({500, 100}, {0, 0}, {2, 9}));
+    REQUIRE(Result::Ok == Doupdate());
+    REQUIRE(Result::Ok == pad.Prefresh({499, 98}, {0, 0}, {2, 9}));
+    REQUIRE(Result::Ok == pad.Pechochar('x'));
+
+    auto subpad = pad.Subpad({10, 10}, {500, 100});
+    REQUIRE(subpad.IsPad());
+    REQUIRE(subpad.IsSubwin());
+    REQUIRE(subpad.GetParent() == &pad);
+    REQUIRE(subpad.Instr({0, 0}, 3) == "pad");
+}
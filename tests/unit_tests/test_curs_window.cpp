@@ -44,3 +44,48 @@ TEST_CASE("curs_window: Window::Derwin")
     REQUIRE(derwindow.GetParent() == &window);
     derwindow.Mvderwin({2, 2});
 }
+
+TEST_CASE("wresize: Window::Resize")
+{
+    const auto _ = Initscr();
+
+    auto window = Window{{3, 4}, {}};
+    auto derwindow = window.Derwin({2, 2}, {1, 2});
+    window.Addstr({0, 0}, "abcd");
+    window.TrackDamage();
+    window.ClearDamage();
+
+    REQUIRE(Result::Ok == window.Resize({4, 6}));
+    REQUIRE(window.Getmaxyx() == PosYx{4, 6});
+    REQUIRE(window.Instr({0, 0}, 6) == "abcd  ");
+    REQUIRE(window.GetDamage() == RectMinMax{{0, 0}, {3, 5}});
+
+    window.ClearDamage();
+    REQUIRE(Result::Ok == window.Resize({2, 3}));
+    REQUIRE(window.Getmaxyx() == PosYx{2, 3});
+    REQUIRE(window.Instr({0, 0}, 3) == "abc");
+    REQUIRE_FALSE(window.GetDamage());
+
+    // The subwindow is shrunk to fit, and is still usable
+    REQUIRE(derwindow.GetParent() == &window);
+    REQUIRE(derwindow.Getmaxyx() == PosYx{1, 1});
+    const auto x = Chtype{'x'};
+    REQUIRE(Result::Ok == derwindow.Addchstr({0, 0}, {&x, 1}));
+    REQUIRE(window.Inch({1, 2}) == 'x');
+
+    REQUIRE(Result::Err == window.Resize({0, 3}));
+}
+
+TEST_CASE("resizeterm: Resizeterm")
+{
+    const auto _ = Initscr();
+    const auto size = SizeLinesCols{Lines(), Cols()};
+
+    REQUIRE_FALSE(IsTermResized(size));
+    REQUIRE(IsTermResized({size.lines + 1, size.cols}));
+    REQUIRE(Result::Ok == Resizeterm({size.lines + 1, size.cols + 2}));
+    REQUIRE(Lines() == size.lines + 1);
+    REQUIRE(Cols() == size.cols + 2);
+    REQUIRE(Result::Ok == Resizeterm(size));
+    REQUIRE(Lines() == size.lines);
+}
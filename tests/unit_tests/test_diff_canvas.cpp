@@ -0,0 +1,95 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/diff_canvas.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace curses;
+
+TEST_CASE("DiffCanvas: Commit only changed runs")
+{
+    const auto _ = Initscr();
+    auto window = Window{{3, 20}, {}};
+
+    auto canvas = DiffCanvas{{3, 20}, '.'};
+    REQUIRE(Result::Ok == canvas.Commit(window));
+    REQUIRE(canvas.GetStats().changed_rows == 3);
+    REQUIRE(canvas.GetStats().runs == 3);
+    REQUIRE(canvas.GetStats().cells == 60);
+    REQUIRE(window.Instr({1, 0}) == "....................");
+
+    REQUIRE(Result::Ok == canvas.Commit(window));
+    REQUIRE(canvas.GetStats().changed_rows == 0);
+    REQUIRE(canvas.GetStats().runs == 0);
+
+    canvas.Back().Put({1, 1}, "A");
+    canvas.Back().Put({1, 3}, "B");
+    canvas.Back().Put({1, 15}, "CD");
+    REQUIRE(Result::Ok == window.Noutrefresh());
+    REQUIRE(Result::Ok == canvas.Commit(window));
+    REQUIRE(canvas.GetStats().changed_rows == 1);
+    REQUIRE(canvas.GetStats().runs == 2);
+    REQUIRE(canvas.GetStats().cells == 5);
+    REQUIRE(window.Instr({1, 0}) == ".A.B...........CD...");
+    REQUIRE(!window.IsLinetouched(0));
+    REQUIRE( window.IsLinetouched(1));
+    REQUIRE(!window.IsLinetouched(2));
+
+    canvas.Invalidate();
+    REQUIRE(Result::Ok == canvas.Commit(window));
+    REQUIRE(canvas.GetStats().cells == 60);
+}
+
+TEST_CASE("DiffCanvas: Commit twice without refresh")
+{
+    const auto _ = Initscr();
+    auto window = Window{{3, 20}, {}};
+    auto canvas = DiffCanvas{{3, 20}, '.'};
+    REQUIRE(Result::Ok == canvas.Commit(window));
+    REQUIRE(Result::Ok == window.Noutrefresh());
+
+    // The second commit must keep the changes of the first
+    canvas.Back().Put({1, 1}, "A");
+    REQUIRE(Result::Ok == canvas.Commit(window));
+    REQUIRE(Result::Ok == canvas.Commit(window));
+    REQUIRE(canvas.GetStats().changed_rows == 0);
+    REQUIRE(window.IsLinetouched(1));
+    REQUIRE(!window.IsLinetouched(0));
+    REQUIRE(window.Instr({1, 0}) == ".A..................");
+}
+
+TEST_CASE("DiffCanvas: Offset and clipping")
+{
+    const auto _ = Initscr();
+    auto window = Window{{3, 8}, {}};
+
+    auto canvas = DiffCanvas{{4, 4}, '.'};
+    REQUIRE(Result::Ok == canvas.Commit(window, {1, 2}));
+    REQUIRE(canvas.GetStats().changed_rows == 2);
+    REQUIRE(window.Instr({0, 0}) == "        ");
+    REQUIRE(window.Instr({1, 0}) == "  ....  ");
+    REQUIRE(window.Instr({2, 0}) == "  ....  ");
+
+    canvas.Back().Put({3, 0}, "X");
+    REQUIRE(Result::Ok == canvas.Commit(window, {1, 2}));
+    REQUIRE(canvas.GetStats().changed_rows == 0);
+}
@@ -0,0 +1,144 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/escdelay_tuner.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+
+using namespace curses;
+using namespace std::chrono_literals;
+
+TEST_CASE("EscdelayTuner")
+{
+    const auto _ = Initscr();
+    const auto escdelay = GetEscdelay();
+    const auto up = "\033[99;9A";
+    const auto down = "\033[99;9B";
+    REQUIRE(Result::Ok == DefineKey(up, Key::Resize + 0101));
+    REQUIRE(Result::Ok == DefineKey(down, Key::Resize + 0102));
+
+    auto now = EscdelayTuner::Clock::now();
+    auto tuner = EscdelayTuner{25, 200, 10, 2, 30s, now};
+    REQUIRE(GetEscdelay() == 25);
+    REQUIRE(tuner.GetEscdelay() == 25);
+
+    const auto observe = [&] (auto gap, int key)
+    {
+        now += gap;
+        tuner.Observe(key, now);
+    };
+    // Observe the bytes of sequence, with gap before the byte at index split
+    const auto observe_split = [&] (auto gap, const char* sequence, int split)
+    {
+        for (auto i = 0; sequence[i] != '\0'; ++i)
+        {
+            observe(i == split ? gap : 0ms, sequence[i]);
+        }
+    };
+
+    SECTION("Keys read together don't change the delay")
+    {
+        // Alt-[ followed by typing
+        observe(0ms, 033);
+        observe(0ms, '[');
+        observe(500ms, 'A');
+        observe(0ms, 033);
+        observe(0ms, 'O');
+        observe(0ms, 'P');
+        observe_split(0ms, up, 0);
+        REQUIRE(tuner.GetEscdelay() == 25);
+        REQUIRE(tuner.GetSplitSequenceCount() == 0);
+    }
+
+    SECTION("Split sequences raise the delay")
+    {
+        // The link stalls 20 ms after ESC
+        observe_split(20ms, up, 1);
+        REQUIRE(tuner.GetSplitSequenceCount() == 1);
+        REQUIRE(tuner.GetMaxGap() == 45ms);
+        REQUIRE(tuner.GetEscdelay() == 25);
+
+        // Split after '[', which ncurses returned together with Escape
+        observe(1s, 0);
+        observe_split(35ms, down, 2);
+        REQUIRE(tuner.GetSplitSequenceCount() == 2);
+        REQUIRE(tuner.GetMaxGap() == 60ms);
+        REQUIRE(tuner.GetEscdelay() == 70);
+        REQUIRE(GetEscdelay() == 70);
+
+        // The delay is capped
+        observe(1s, 0);
+        observe_split(180ms, up, 1);
+        REQUIRE(tuner.GetSplitSequenceCount() == 3);
+        REQUIRE(tuner.GetEscdelay() == 200);
+        REQUIRE(GetEscdelay() == 200);
+
+        // The delay decays without split sequences
+        observe(30s, 0);
+        REQUIRE(tuner.GetEscdelay() == 112);
+        observe(60s, 0);
+        REQUIRE(tuner.GetEscdelay() == 46);
+        observe(10min, 0);
+        REQUIRE(tuner.GetEscdelay() == 25);
+        REQUIRE(GetEscdelay() == 25);
+    }
+
+    SECTION("A single split sequence per decay period doesn't raise the delay")
+    {
+        for (auto i = 0; i < 5; ++i)
+        {
+            observe(30s, 0);
+            observe_split(100ms, up, 1);
+        }
+        REQUIRE(tuner.GetSplitSequenceCount() == 5);
+        REQUIRE(tuner.GetEscdelay() == 25);
+    }
+
+    SECTION("Typed keys that look like a sequence")
+    {
+        // Escape, '[' and a letter typed by hand
+        for (auto i = 0; i < 5; ++i)
+        {
+            observe(1s, 033);
+            observe(150ms, '[');
+            observe(150ms, 'x');
+        }
+        REQUIRE(tuner.GetSplitSequenceCount() == 0);
+        REQUIRE(tuner.GetEscdelay() == 25);
+    }
+
+    SECTION("Other keys after Escape")
+    {
+        observe(0ms, 033);
+        observe(20ms, 'x');
+        observe(20ms, '[');
+        observe(20ms, 033);
+        observe(20ms, Key::Up);
+        REQUIRE(tuner.GetSplitSequenceCount() == 0);
+        REQUIRE(tuner.GetEscdelay() == 25);
+    }
+
+    REQUIRE(Result::Ok == DefineKey(nullptr, Key::Resize + 0101));
+    REQUIRE(Result::Ok == DefineKey(nullptr, Key::Resize + 0102));
+    REQUIRE(Result::Ok == SetEscdelay(escdelay));
+}
@@ -0,0 +1,143 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/event_loop.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signal.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <vector>
+
+using namespace curses;
+using namespace std::chrono_literals;
+
+TEST_CASE("EventLoop: Timers")
+{
+    const auto _ = Initscr();
+    auto window = Window({}, {});
+    auto loop = EventLoop{window};
+
+    auto fired = std::vector<int>{};
+    loop.AddTimer(20ms, [&] { fired.push_back(2); });
+    loop.AddTimer(1ms, [&] { fired.push_back(1); });
+    const auto cancelled = loop.AddTimer(5ms, [&] { fired.push_back(3); });
+    loop.CancelTimer(cancelled);
+    for (int i = 0; i < 100 && fired.size() < 2; ++i) REQUIRE(Result::Ok == loop.RunOnce(100));
+    REQUIRE(fired == std::vector<int>{1, 2});
+
+    auto count = 0;
+    auto periodic = EventLoop::TimerId{};
+    periodic = loop.AddTimer(1ms, [&] { if (++count == 3) loop.CancelTimer(periodic); }, 1ms);
+    for (int i = 0; i < 100 && count < 3; ++i) REQUIRE(Result::Ok == loop.RunOnce(100));
+    REQUIRE(count == 3);
+    REQUIRE(Result::Ok == loop.RunOnce(10));
+    REQUIRE(count == 3);
+}
+
+TEST_CASE("EventLoop: File descriptors and Stop")
+{
+    const auto _ = Initscr();
+    auto window = Window({}, {});
+    auto loop = EventLoop{window};
+
+    auto fds = std::array<int, 2>{};
+    REQUIRE(pipe(fds.data()) == 0);
+    auto received = std::vector<char>{};
+    REQUIRE(Result::Ok == loop.AddFd(fds[0], [&] (int fd)
+    {
+        auto c = char{};
+        REQUIRE(read(fd, &c, 1) == 1);
+        received.push_back(c);
+        if (c == 'q') loop.Stop();
+    }));
+    REQUIRE(Result::Err == loop.AddFd(-1, [] (int) {}));
+
+    REQUIRE(write(fds[1], "a", 1) == 1);
+    REQUIRE(Result::Ok == loop.RunOnce(100));
+    REQUIRE(received == std::vector<char>{'a'});
+
+    loop.AddTimer(1ms, [&] { REQUIRE(write(fds[1], "q", 1) == 1); });
+    REQUIRE(Result::Ok == loop.Run());
+    REQUIRE(received == std::vector<char>{'a', 'q'});
+
+    REQUIRE(Result::Ok == loop.RemoveFd(fds[0]));
+    REQUIRE(Result::Err == loop.RemoveFd(fds[0]));
+    REQUIRE(write(fds[1], "b", 1) == 1);
+    REQUIRE(Result::Ok == loop.RunOnce(10));
+    REQUIRE(received.size() == 2);
+    close(fds[0]);
+    close(fds[1]);
+}
+
+TEST_CASE("EventLoop: Keys and SIGWINCH")
+{
+    const auto _ = Initscr();
+    auto window = Window({}, {});
+    window.Keypad();
+    auto loop = EventLoop{window};
+
+    auto keys = std::vector<int>{};
+    loop.OnKey([&] (int key) { keys.push_back(key); });
+    REQUIRE(Result::Ok == Flushinp());
+    REQUIRE(Result::Ok == Ungetch('a'));
+    REQUIRE(Result::Ok == Ungetch(Key::F1));
+    loop.PollInput();
+    REQUIRE(keys == std::vector<int>{Key::F1, 'a'});
+    REQUIRE_FALSE(window.IsNodelay());
+
+    // Give the terminal a real size. Setting it sends SIGWINCH, which is
+    // received with the signalfd instead of running the ncurses handler.
+    auto old_size = winsize{};
+    REQUIRE(ioctl(STDOUT_FILENO, TIOCGWINSZ, &old_size) == 0);
+    auto size = winsize{};
+    size.ws_row = old_size.ws_row == 40 ? 41 : 40;
+    size.ws_col = 120;
+    REQUIRE(ioctl(STDOUT_FILENO, TIOCSWINSZ, &size) == 0);
+    REQUIRE(raise(SIGWINCH) == 0);
+    keys.clear();
+    REQUIRE(Result::Ok == loop.RunOnce(100));
+    REQUIRE(keys == std::vector<int>{Key::Resize});
+    REQUIRE(Lines() == size.ws_row);
+    REQUIRE(Cols() == 120);
+
+    // The size didn't change, so no Key::Resize
+    keys.clear();
+    REQUIRE(raise(SIGWINCH) == 0);
+    REQUIRE(Result::Ok == loop.RunOnce(100));
+    REQUIRE(keys.empty());
+
+    size.ws_row = 30;
+    REQUIRE(ioctl(STDOUT_FILENO, TIOCSWINSZ, &size) == 0);
+    REQUIRE(raise(SIGWINCH) == 0);
+    REQUIRE(Result::Ok == loop.RunOnce(100));
+    REQUIRE(keys == std::vector<int>{Key::Resize});
+    REQUIRE(Lines() == 30);
+
+    REQUIRE(ioctl(STDOUT_FILENO, TIOCSWINSZ, &old_size) == 0);
+    REQUIRE(raise(SIGWINCH) == 0);
+    REQUIRE(Result::Ok == loop.RunOnce(100));
+    Flushinp();
+}
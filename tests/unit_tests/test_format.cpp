@@ -0,0 +1,148 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/curses.hpp"
+#include "curses_cpp/format.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+using namespace curses;
+
+namespace
+{
+
+template<typename... Args>
+std::string Format(const FormatString<detail::TypeIdentity<Args>...>& fmt, const Args&... args)
+{
+    auto buf = std::array<char, 256>{};
+    const auto n = FormatTo<Args...>(buf.data(), static_cast<int>(buf.size()), fmt, args...);
+    return {buf.data(), static_cast<std::size_t>(n)};
+}
+
+constexpr auto ConstexprFormat = FormatString<int, const char*>{"{:>5}|{}"};
+static_assert(ConstexprFormat.GetNumSegments() == 3);
+
+} // namespace
+
+TEST_CASE("FormatTo: Literals")
+{
+    REQUIRE(Format("").empty());
+    REQUIRE(Format("abc") == "abc");
+    REQUIRE(Format("{{}}") == "{}");
+    REQUIRE(Format("a{{b}}c{}", 1) == "a{b}c1");
+}
+
+TEST_CASE("FormatTo: Integers")
+{
+    REQUIRE(Format("{}", 0) == "0");
+    REQUIRE(Format("{} {}", -12, 34U) == "-12 34");
+    REQUIRE(Format("{}", std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+    REQUIRE(Format("{}", std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+    REQUIRE(Format("{:x} {:X} {:o} {:b}", 255, 255, 8, 5) == "ff FF 10 101");
+    REQUIRE(Format("{:5}|{:<5}|{:^5}|{:*>5}", 42, 42, 42, 42) == "   42|42   | 42  |***42");
+    REQUIRE(Format("{:05}|{:05}", 42, -42) == "00042|-0042");
+    REQUIRE(Format("{:1}", 12345) == "12345");
+    REQUIRE(Format("{:c}", 65) == "A");
+}
+
+TEST_CASE("FormatTo: Floating point")
+{
+    REQUIRE(Format("{}", 1.5) == "1.5");
+    REQUIRE(Format("{:.2f}", 3.14159) == "3.14");
+    REQUIRE(Format("{:.3}", 2.0F) == "2.000");
+    REQUIRE(Format("{:8.2f}", -3.14159) == "   -3.14");
+    REQUIRE(Format("{:08.2f}", -3.14159) == "-0003.14");
+    REQUIRE(Format("{:.1e}", 1500.0) == "1.5e+03");
+}
+
+TEST_CASE("FormatTo: Strings, chars and bools")
+{
+    const auto str = std::string{"hello"};
+    REQUIRE(Format("{}, {}!", str, "world") == "hello, world!");
+    REQUIRE(Format("{:.3}", std::string_view{"abcdef"}) == "abc");
+    REQUIRE(Format("[{:7}][{:>7}][{:-^7}]", "abc", "abc", "abc") == "[abc    ][    abc][--abc--]");
+    REQUIRE(Format("{}{:3}|", 'x', 'y') == "xy  |");
+    REQUIRE(Format("{} {:s}", true, false) == "true false");
+}
+
+TEST_CASE("FormatTo: Truncation")
+{
+    auto buf = std::array<char, 8>{};
+    REQUIRE(FormatTo(buf.data(), 4, "{:>10}", 1) == 4);
+    REQUIRE(std::string(buf.data(), 4) == "    ");
+    REQUIRE(FormatTo(buf.data(), 0, "abc") == 0);
+}
+
+TEST_CASE("FormatString: Constexpr")
+{
+    REQUIRE(ConstexprFormat.Get() == "{:>5}|{}");
+    REQUIRE(Format<int, const char*>(ConstexprFormat, 7, "x") == "    7|x");
+}
+
+TEST_CASE("FormatString: CURSES_CPP_FORMAT")
+{
+    REQUIRE(Format(CURSES_CPP_FORMAT("{:>3}|{{{}}}"), 7, "x") == "  7|{x}");
+    REQUIRE(Format(CURSES_CPP_FORMAT("abc")) == "abc");
+    const auto fmt = FormatString<int>{CURSES_CPP_FORMAT("{:x}")};
+    REQUIRE(fmt.GetNumSegments() == 2);
+}
+
+TEST_CASE("FormatString: Invalid")
+{
+    // With consteval these are compile errors instead
+#if !defined(__cpp_consteval)
+    REQUIRE_THROWS_AS((FormatString<int>{"{"}), std::invalid_argument);
+    REQUIRE_THROWS_AS((FormatString<int>{"}"}), std::invalid_argument);
+    REQUIRE_THROWS_AS((FormatString<int>{"{} {}"}), std::invalid_argument);
+    REQUIRE_THROWS_AS((FormatString<int, int>{"{}"}), std::invalid_argument);
+    REQUIRE_THROWS_AS((FormatString<int>{"{:s}"}), std::invalid_argument);
+    REQUIRE_THROWS_AS((FormatString<int>{"{:.2}"}), std::invalid_argument);
+    REQUIRE_THROWS_AS((FormatString<double>{"{:.}"}), std::invalid_argument);
+    REQUIRE_THROWS_AS((FormatString<int>{"{:5q}"}), std::invalid_argument);
+    REQUIRE_THROWS_AS((FormatString<>{"{{}}{{}}{{}}{{}}{{"}), std::invalid_argument);
+#endif
+    REQUIRE_NOTHROW((FormatString<>{"{{}}{{}}{{}}{{}}"}));
+}
+
+TEST_CASE("Window::Print")
+{
+    const auto _ = Initscr();
+    auto window = Window({3, 40}, {});
+
+    REQUIRE(Result::Ok == window.Print({1, 2}, "fps: {:>4} load: {:.1f}%", 60, 12.34));
+    REQUIRE(window.Getyx() == PosYx{1, 23});
+    REQUIRE(window.Instr({1, 0}, 25) == "  fps:   60 load: 12.3%  ");
+
+    window.Move({0, 0});
+    REQUIRE(Result::Ok == window.Print("{}", "abc"));
+    REQUIRE(Result::Ok == window.Print("def"));
+    REQUIRE(window.Instr({0, 0}, 6) == "abcdef");
+    REQUIRE(Result::Ok == window.Print({2, 0}, CURSES_CPP_FORMAT("{:03}"), 5));
+    REQUIRE(window.Instr({2, 0}, 3) == "005");
+
+    REQUIRE(Result::Err == window.Print({5, 0}, "{}", 1));
+}
@@ -0,0 +1,103 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/frame_scheduler.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+
+using namespace curses;
+using namespace std::chrono_literals;
+
+TEST_CASE("FrameScheduler: Schedule, Unschedule")
+{
+    const auto _ = Initscr();
+    auto window0 = Window{{1, 1}, {0, 0}};
+    auto window1 = Window{{1, 1}, {1, 0}};
+
+    auto scheduler = FrameScheduler{};
+    REQUIRE(!scheduler.IsPending());
+    scheduler.Schedule(window0);
+    scheduler.Schedule(window0);
+    scheduler.Schedule(window1);
+    REQUIRE(scheduler.IsPending());
+    REQUIRE(scheduler.IsScheduled(window0));
+    REQUIRE(scheduler.IsScheduled(window1));
+    scheduler.Unschedule(window0);
+    REQUIRE(!scheduler.IsScheduled(window0));
+    REQUIRE(scheduler.IsScheduled(window1));
+    scheduler.Unschedule(window1);
+    REQUIRE(!scheduler.IsPending());
+}
+
+TEST_CASE("FrameScheduler: One Doupdate per frame")
+{
+    const auto _ = Initscr();
+    auto window0 = Window{{1, 1}, {0, 0}};
+    auto window1 = Window{{1, 1}, {1, 0}};
+    window0.Addch('A');
+    window1.Addch('B');
+    REQUIRE(window0.IsWintouched());
+    REQUIRE(window1.IsWintouched());
+
+    auto scheduler = FrameScheduler{10};
+    REQUIRE(scheduler.GetFramePeriod() == 100ms);
+
+    const auto t0 = FrameScheduler::Clock::now();
+    scheduler.Schedule(window0);
+    scheduler.Schedule(window1);
+    REQUIRE(Result::Ok == scheduler.Tick(t0));
+    REQUIRE(scheduler.GetFrameCount() == 1);
+    REQUIRE(!scheduler.IsPending());
+    REQUIRE(!window0.IsWintouched());
+    REQUIRE(!window1.IsWintouched());
+
+    // Too early for the next frame
+    scheduler.Schedule(window0);
+    REQUIRE(scheduler.TimeUntilNextFrame(t0 + 40ms) == 60ms);
+    REQUIRE(Result::Ok == scheduler.Tick(t0 + 40ms));
+    REQUIRE(scheduler.GetFrameCount() == 1);
+    REQUIRE(scheduler.IsPending());
+
+    REQUIRE(Result::Ok == scheduler.Tick(t0 + 100ms));
+    REQUIRE(scheduler.GetFrameCount() == 2);
+    REQUIRE(!scheduler.IsPending());
+
+    // Nothing to flush
+    REQUIRE(Result::Ok == scheduler.Tick(t0 + 300ms));
+    REQUIRE(scheduler.GetFrameCount() == 2);
+}
+
+TEST_CASE("FrameScheduler: FlushNow")
+{
+    const auto _ = Initscr();
+    auto window = Window{{1, 1}, {0, 0}};
+
+    auto scheduler = FrameScheduler{10};
+    const auto t0 = FrameScheduler::Clock::now();
+    scheduler.Schedule(window);
+    REQUIRE(Result::Ok == scheduler.Tick(t0));
+    scheduler.Schedule(window);
+    REQUIRE(Result::Ok == scheduler.FlushNow(t0 + 1ms));
+    REQUIRE(scheduler.GetFrameCount() == 2);
+    REQUIRE(scheduler.GetNextFrameTime() == t0 + 101ms);
+}
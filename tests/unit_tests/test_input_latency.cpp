@@ -0,0 +1,123 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/input_latency.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+using namespace curses;
+using namespace std::chrono_literals;
+
+TEST_CASE("LatencyHistogram")
+{
+    auto histogram = LatencyHistogram{};
+    REQUIRE(histogram.GetCount() == 0);
+    REQUIRE(histogram.GetMin() == 0ns);
+    REQUIRE(histogram.GetMean() == 0ns);
+    REQUIRE(histogram.GetPercentile(50) == 0ns);
+
+    SECTION("Small durations are exact")
+    {
+        for (int i = 1; i <= 10; ++i) histogram.Record(std::chrono::nanoseconds{i});
+        REQUIRE(histogram.GetCount() == 10);
+        REQUIRE(histogram.GetMin() == 1ns);
+        REQUIRE(histogram.GetMax() == 10ns);
+        REQUIRE(histogram.GetPercentile(0) == 1ns);
+        REQUIRE(histogram.GetPercentile(50) == 5ns);
+        REQUIRE(histogram.GetPercentile(100) == 10ns);
+    }
+
+    SECTION("Large durations are within a bucket")
+    {
+        for (int i = 0; i < 99; ++i) histogram.Record(1ms);
+        histogram.Record(1s);
+        REQUIRE(histogram.GetCount() == 100);
+        const auto p50 = histogram.GetPercentile(50);
+        REQUIRE(p50 >= 1ms);
+        REQUIRE(p50 <= std::chrono::nanoseconds{1ms} * 33 / 32);
+        REQUIRE(histogram.GetPercentile(99) == p50);
+        REQUIRE(histogram.GetPercentile(100) == 1s);
+        REQUIRE(histogram.GetMean() == 10990us);
+    }
+
+    SECTION("Reset")
+    {
+        histogram.Record(5us);
+        histogram.Record(-5us);
+        REQUIRE(histogram.GetMin() == 0ns);
+        histogram.Reset();
+        REQUIRE(histogram.GetCount() == 0);
+        REQUIRE(histogram.GetMax() == 0ns);
+    }
+
+    SECTION("Write")
+    {
+        histogram.Record(3ns);
+        histogram.Record(3ns);
+        histogram.Record(100ns);
+        auto* file = std::tmpfile();
+        REQUIRE(file);
+        REQUIRE(histogram.Write(file) == Result::Ok);
+        std::rewind(file);
+        auto buf = std::string(256, '\0');
+        buf.resize(std::fread(buf.data(), 1, buf.size(), file));
+        std::fclose(file);
+        REQUIRE(buf.rfind("# count 3 min 3 ", 0) == 0);
+        REQUIRE(buf.find("\n3 2\n101 1\n") != std::string::npos);
+
+        REQUIRE(histogram.Write("/nonexistent/latency.txt") == Result::Err);
+    }
+}
+
+TEST_CASE("Input latency")
+{
+    const auto _ = Initscr();
+    auto window = Window({}, {});
+    Flushinp();
+    ResetInputLatency();
+
+    Ungetch('a');
+    Ungetch('b');
+    REQUIRE(window.Getch() == 'b');
+    REQUIRE(window.Getch() == 'a');
+    std::this_thread::sleep_for(2ms);
+    REQUIRE(Doupdate() == Result::Ok);
+    REQUIRE(Doupdate() == Result::Ok);
+
+    const auto latency = GetInputLatency();
+    if (IsInputLatencyEnabled())
+    {
+        REQUIRE(latency.GetCount() == 2);
+        REQUIRE(latency.GetMin() >= 2ms);
+    }
+    else
+    {
+        REQUIRE(latency.GetCount() == 0);
+    }
+
+    ResetInputLatency();
+    REQUIRE(GetInputLatency().GetCount() == 0);
+}
@@ -0,0 +1,166 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/input_recording.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace curses;
+using namespace std::chrono_literals;
+
+TEST_CASE("InputRecorder and InputReplayer")
+{
+    const auto _ = Initscr();
+    Mousemask(Mmask::AllMouseEvents);
+    auto window = Window({}, {});
+    window.Keypad();
+    Flushinp();
+
+    const auto path = std::string{"test_input_recording.rec"};
+    const auto start = InputRecorder::Clock::now();
+
+    auto click = Mevent{};
+    click.y = 3;
+    click.x = 400;
+    click.bstate = Mmask::Button1Clicked | Mmask::ButtonShift;
+    {
+        auto recorder = InputRecorder{path, start};
+        REQUIRE(recorder.Record('a', start + 10ms) == Result::Ok);
+        REQUIRE(recorder.Record(Key::Mouse, click, start + 25ms) == Result::Ok);
+        const auto keys = std::array<int, 2>{Key::F0 + 5, 'b'};
+        REQUIRE(recorder.Record(keys.data(), nullptr, 2, start + 1s) == Result::Ok);
+        REQUIRE(recorder.GetEventCount() == 4);
+        REQUIRE(recorder.Flush() == Result::Ok);
+    }
+
+    SECTION("Events")
+    {
+        const auto replayer = InputReplayer{path};
+        const auto& events = replayer.GetEvents();
+        REQUIRE(events.size() == 4);
+        REQUIRE(events[0].time == 10ms);
+        REQUIRE(events[0].key == 'a');
+        REQUIRE(events[1].time == 25ms);
+        REQUIRE(events[1].key == Key::Mouse);
+        REQUIRE(events[1].mouse_event.Getyx() == PosYx{3, 400});
+        REQUIRE(events[1].mouse_event.bstate == click.bstate);
+        REQUIRE(events[2].key == Key::F0 + 5);
+        REQUIRE(events[3].time == 1s);
+        REQUIRE(events[3].key == 'b');
+    }
+
+    SECTION("As fast as possible")
+    {
+        auto replayer = InputReplayer{path};
+        auto keys = std::vector<int>{};
+        while (!replayer.IsDone())
+        {
+            REQUIRE(replayer.TimeUntilNext() == 0s);
+            REQUIRE(replayer.Feed());
+            keys.push_back(window.Getch());
+            if (keys.back() == Key::Mouse)
+            {
+                const auto event = Getmouse();
+                REQUIRE(event);
+                REQUIRE(event->Getyx() == PosYx{3, 400});
+            }
+        }
+        REQUIRE(keys == std::vector<int>{'a', Key::Mouse, Key::F0 + 5, 'b'});
+        REQUIRE_FALSE(replayer.Feed());
+    }
+
+    SECTION("Original speed")
+    {
+        const auto replay_start = InputReplayer::Clock::now();
+        auto replayer = InputReplayer{path, InputReplayer::Speed::Original, replay_start};
+        REQUIRE(replayer.TimeUntilNext(replay_start) == 10ms);
+        REQUIRE_FALSE(replayer.Feed(replay_start + 9ms));
+        REQUIRE(replayer.Feed(replay_start + 10ms));
+        REQUIRE_FALSE(replayer.Feed(replay_start + 10ms));
+        REQUIRE(window.Getch() == 'a');
+        REQUIRE(replayer.GetNumFed() == 1);
+        REQUIRE(replayer.TimeUntilNext(replay_start + 20ms) == 5ms);
+        Flushinp();
+    }
+
+    SECTION("Invalid files")
+    {
+        REQUIRE_THROWS_AS(InputReplayer{"nonexistent.rec"}, std::runtime_error);
+        REQUIRE_THROWS_AS(InputRecorder{"/nonexistent/test.rec"}, std::runtime_error);
+
+        // Truncate in the middle of the mouse event
+        auto* file = std::fopen(path.c_str(), "r+b");
+        REQUIRE(file);
+        auto bytes = std::array<unsigned char, 64>{};
+        const auto n = std::fread(bytes.data(), 1, bytes.size(), file);
+        std::fclose(file);
+        REQUIRE(n > 12);
+        file = std::fopen(path.c_str(), "wb");
+        REQUIRE(file);
+        std::fwrite(bytes.data(), 1, 12, file);
+        std::fclose(file);
+        REQUIRE_THROWS_AS(InputReplayer{path}, std::runtime_error);
+
+        // Truncate in the middle of the time delta of the mouse event, after
+        // the magic (5 bytes) and 'a' (2 byte delta, 2 byte zigzag key)
+        file = std::fopen(path.c_str(), "wb");
+        REQUIRE(file);
+        std::fwrite(bytes.data(), 1, 10, file);
+        std::fclose(file);
+        REQUIRE_THROWS_AS(InputReplayer{path}, std::runtime_error);
+        file = std::fopen(path.c_str(), "wb");
+        REQUIRE(file);
+        std::fwrite(bytes.data(), 1, 9, file);
+        std::fclose(file);
+        REQUIRE(InputReplayer{path}.GetEvents().size() == 1);
+
+        file = std::fopen(path.c_str(), "wb");
+        REQUIRE(file);
+        std::fputs("not a recording", file);
+        std::fclose(file);
+        REQUIRE_THROWS_AS(InputReplayer{path}, std::runtime_error);
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST_CASE("InputRecorder: Write errors")
+{
+    // Writes fail once the stdio buffer is flushed
+    auto recorder = InputRecorder{"/dev/full"};
+    const auto start = InputRecorder::Clock::now();
+    auto num_ok = 0;
+    while (num_ok < 100000 && recorder.Record('a', start + std::chrono::milliseconds{num_ok}) == Result::Ok) ++num_ok;
+    REQUIRE(num_ok < 100000);
+    REQUIRE(recorder.GetEventCount() == num_ok);
+
+    // Only events that were written are counted
+    const auto res = recorder.Record('b');
+    REQUIRE(recorder.GetEventCount() == num_ok + (res == Result::Ok ? 1 : 0));
+    REQUIRE(recorder.Flush() == Result::Err);
+}
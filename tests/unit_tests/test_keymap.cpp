@@ -0,0 +1,114 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/keymap.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace curses;
+
+namespace
+{
+
+enum class Command
+{
+    None,
+    Quit,
+    Up,
+    Save,
+    Open,
+    WordRight,
+};
+
+constexpr auto keymap = KeyMap<Command>{}
+        .Bind('q', Command::Quit)
+        .Bind(Key::Up, Command::Up)
+        .Bind({CtrlKey('x'), CtrlKey('s')}, Command::Save)
+        .Bind({CtrlKey('x'), CtrlKey('f')}, Command::Open)
+        .BindAlt('f', Command::WordRight);
+
+static_assert(keymap.Lookup('q').match == KeyMatch::Complete);
+static_assert(keymap.Lookup('q').action == Command::Quit);
+static_assert(keymap.Lookup(Key::Up).action == Command::Up);
+static_assert(keymap.Lookup('w').match == KeyMatch::None);
+
+} // namespace
+
+TEST_CASE("KeyMap: Single keys")
+{
+    REQUIRE(CtrlKey('x') == 030);
+    REQUIRE(CtrlKey('X') == 030);
+
+    REQUIRE(keymap.Lookup(Key::Up).match == KeyMatch::Complete);
+    REQUIRE(keymap.Lookup(Key::Down).match == KeyMatch::None);
+    REQUIRE(keymap.Lookup(-1).match == KeyMatch::None);
+    REQUIRE(keymap.Lookup(KeyMap<Command>::NumKeys).match == KeyMatch::None);
+}
+
+TEST_CASE("KeyMap: Chords")
+{
+    const auto prefix = keymap.Lookup(CtrlKey('x'));
+    REQUIRE(prefix.match == KeyMatch::Prefix);
+    REQUIRE(prefix.node != 0);
+
+    const auto save = keymap.Lookup(CtrlKey('s'), prefix.node);
+    REQUIRE(save.match == KeyMatch::Complete);
+    REQUIRE(save.action == Command::Save);
+    REQUIRE(save.node == 0);
+    REQUIRE(keymap.Lookup(CtrlKey('f'), prefix.node).action == Command::Open);
+    REQUIRE(keymap.Lookup('q', prefix.node).match == KeyMatch::None);
+
+    // Ctrl-S alone isn't bound
+    REQUIRE(keymap.Lookup(CtrlKey('s')).match == KeyMatch::None);
+
+    const auto alt = keymap.Lookup(EscapeKey);
+    REQUIRE(alt.match == KeyMatch::Prefix);
+    REQUIRE(keymap.Lookup('f', alt.node).action == Command::WordRight);
+}
+
+TEST_CASE("KeyMap: Dispatch loop")
+{
+    auto commands = std::vector<Command>{};
+    auto node = 0;
+    for (const auto key : {int{'a'}, CtrlKey('x'), CtrlKey('s'), EscapeKey, int{'f'}, int{'q'}})
+    {
+        const auto match = keymap.Lookup(key, node);
+        node = match.node;
+        if (match.match == KeyMatch::Complete) commands.push_back(match.action);
+    }
+    REQUIRE(commands == std::vector<Command>{Command::Save, Command::WordRight, Command::Quit});
+}
+
+TEST_CASE("KeyMap: Conflicts")
+{
+    auto map = KeyMap<Command, 2>{};
+    map.Bind({'g', 'g'}, Command::Up);
+    REQUIRE_THROWS_AS(map.Bind('g', Command::Quit), std::invalid_argument);
+    REQUIRE_THROWS_AS(map.Bind({'g', 'g', 'g'}, Command::Quit), std::invalid_argument);
+    REQUIRE_THROWS_AS(map.Bind(-1, Command::Quit), std::invalid_argument);
+
+    map.Bind({'g', 'e'}, Command::Save);
+    REQUIRE_THROWS_AS(map.Bind({'g', 'x'}, Command::Quit), std::invalid_argument);
+    REQUIRE(map.Lookup('e', map.Lookup('g').node).action == Command::Save);
+}
@@ -0,0 +1,160 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/layout.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace curses;
+
+namespace
+{
+
+struct Screen
+{
+    explicit Screen(Window& root) : layout{root}
+    {
+        header = layout.Add(Layout::Root, LayoutSize::Fixed(1));
+        body = layout.Add(Layout::Root, LayoutSize::Flex(), Layout::Direction::Horizontal);
+        footer = layout.Add(Layout::Root, LayoutSize::Fixed(2));
+        sidebar = layout.Add(body, LayoutSize::Fixed(20));
+        main = layout.Add(body, LayoutSize::Flex(2));
+        aside = layout.Add(body, LayoutSize::Flex(1, 25));
+    }
+
+    Layout layout;
+    Layout::Node header;
+    Layout::Node body;
+    Layout::Node footer;
+    Layout::Node sidebar;
+    Layout::Node main;
+    Layout::Node aside;
+};
+
+} // namespace
+
+TEST_CASE("Layout")
+{
+    const auto _ = Initscr();
+    auto root = Window({20, 80}, {2, 0});
+    auto screen = Screen{root};
+    auto& layout = screen.layout;
+
+    REQUIRE(Result::Ok == layout.Update());
+    REQUIRE(layout.GetStats().created == 6);
+    REQUIRE(layout.GetStats().visited == 2);
+
+    REQUIRE(layout.GetTopLeft(screen.header) == PosYx{0, 0});
+    REQUIRE(layout.GetSize(screen.header) == SizeLinesCols{1, 80});
+    REQUIRE(layout.GetTopLeft(screen.body) == PosYx{1, 0});
+    REQUIRE(layout.GetSize(screen.body) == SizeLinesCols{17, 80});
+    REQUIRE(layout.GetTopLeft(screen.footer) == PosYx{18, 0});
+    REQUIRE(layout.GetSize(screen.footer) == SizeLinesCols{2, 80});
+
+    // 60 flex cells: main gets 40 and aside 20, below its minimum. So aside
+    // gets 25 and main the remaining 35.
+    REQUIRE(layout.GetSize(screen.sidebar) == SizeLinesCols{17, 20});
+    REQUIRE(layout.GetTopLeft(screen.main) == PosYx{0, 20});
+    REQUIRE(layout.GetSize(screen.main) == SizeLinesCols{17, 35});
+    REQUIRE(layout.GetTopLeft(screen.aside) == PosYx{0, 55});
+    REQUIRE(layout.GetSize(screen.aside) == SizeLinesCols{17, 25});
+
+    auto& main = layout.GetWindow(screen.main);
+    REQUIRE(main.IsSubwin());
+    REQUIRE(main.Getbegyx() == PosYx{3, 20});
+    REQUIRE(main.Getparyx() == PosYx{0, 20});
+    REQUIRE(main.Getmaxyx() == PosYx{17, 35});
+    REQUIRE(&layout.GetWindow(Layout::Root) == &root);
+
+    // Nothing changed
+    REQUIRE(Result::Ok == layout.Update());
+    REQUIRE(layout.GetStats().visited == 0);
+    REQUIRE_FALSE(layout.IsChanged(screen.header));
+}
+
+TEST_CASE("Layout: Incremental")
+{
+    const auto _ = Initscr();
+    auto root = Window({20, 80}, {});
+    auto screen = Screen{root};
+    auto& layout = screen.layout;
+    REQUIRE(Result::Ok == layout.Update());
+
+    auto* header_window = layout.GetWindow(screen.header).Get();
+    auto* main_window = layout.GetWindow(screen.main).Get();
+    layout.GetWindow(screen.header).Addstr({0, 0}, "Title");
+
+    layout.SetLayoutSize(screen.sidebar, LayoutSize::Fixed(30));
+    REQUIRE(Result::Ok == layout.Update());
+    REQUIRE(layout.GetStats().visited == 2);
+    REQUIRE(layout.GetStats().created == 0);
+    REQUIRE(layout.GetStats().moved == 1);
+    REQUIRE(layout.GetStats().resized == 2);
+    REQUIRE_FALSE(layout.IsChanged(screen.header));
+    REQUIRE_FALSE(layout.IsChanged(screen.body));
+    REQUIRE(layout.IsChanged(screen.sidebar));
+    REQUIRE(layout.IsChanged(screen.main));
+    REQUIRE_FALSE(layout.IsChanged(screen.aside));
+
+    // Windows are kept, moved and resized
+    REQUIRE(layout.GetWindow(screen.header).Get() == header_window);
+    REQUIRE(layout.GetWindow(screen.main).Get() == main_window);
+    REQUIRE(layout.GetWindow(screen.main).Getbegyx() == PosYx{1, 30});
+    REQUIRE(layout.GetWindow(screen.main).Getmaxyx() == PosYx{17, 25});
+    REQUIRE(layout.GetWindow(screen.header).Instr({0, 0}, 5) == "Title");
+
+    // Moving the root window moves all windows on the screen
+    REQUIRE(Result::Ok == root.Mvwin({3, 0}));
+    REQUIRE(Result::Ok == layout.Update());
+    REQUIRE(layout.GetStats().moved == 6);
+    REQUIRE(layout.GetWindow(screen.main).Getbegyx() == PosYx{4, 30});
+    REQUIRE(layout.GetWindow(screen.footer).Getbegyx() == PosYx{21, 0});
+}
+
+TEST_CASE("Layout: Empty nodes")
+{
+    const auto _ = Initscr();
+    auto root = Window({20, 80}, {});
+    auto screen = Screen{root};
+    auto& layout = screen.layout;
+    REQUIRE(Result::Ok == layout.Update());
+
+    // Body and its children lose their windows
+    layout.SetLayoutSize(screen.header, LayoutSize::Fixed(18));
+    REQUIRE(Result::Ok == layout.Update());
+    REQUIRE(layout.GetSize(screen.body) == SizeLinesCols{0, 80});
+    REQUIRE(layout.GetStats().destroyed == 4);
+    REQUIRE(layout.GetWindow(screen.body).Get() == nullptr);
+    REQUIRE(layout.GetWindow(screen.main).Get() == nullptr);
+
+    layout.SetLayoutSize(screen.header, LayoutSize::Fixed(1));
+    REQUIRE(Result::Ok == layout.Update());
+    REQUIRE(layout.GetStats().created == 4);
+    REQUIRE(layout.GetWindow(screen.main).Getbegyx() == PosYx{1, 20});
+
+    // Children that don't fit are clipped
+    layout.SetLayoutSize(screen.footer, LayoutSize::Fixed(100));
+    layout.SetLayoutSize(screen.sidebar, LayoutSize::Fixed(100));
+    REQUIRE(Result::Ok == layout.Update());
+    REQUIRE(layout.GetSize(screen.footer) == SizeLinesCols{19, 80});
+    REQUIRE(layout.GetSize(screen.body) == SizeLinesCols{0, 80});
+    REQUIRE(layout.GetSize(screen.sidebar) == SizeLinesCols{0, 80});
+}
@@ -0,0 +1,200 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/line_editor.hpp"
+#include "curses_cpp/keymap.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace curses;
+
+namespace
+{
+
+void Type(LineEditor& editor, std::string_view text)
+{
+    for (const auto ch : text) editor.HandleKey(static_cast<unsigned char>(ch));
+}
+
+// Contents of the editor's row, without trailing spaces
+std::string Row(Window& window, int y)
+{
+    const auto cursor = window.Getyx();
+    auto row = window.Instr({y, 0});
+    window.Move(cursor);
+    row.erase(row.find_last_not_of(' ') + 1);
+    return row;
+}
+
+} // namespace
+
+TEST_CASE("LineEditor: Editing")
+{
+    const auto _ = Initscr();
+    auto window = Window({5, 20}, {0, 0});
+    window.Addstr({1, 0}, "> ");
+    auto editor = LineEditor{window, {1, 2}};
+    REQUIRE(window.Getyx() == PosYx{1, 2});
+
+    Type(editor, "hello world");
+    REQUIRE(editor.GetLine() == "hello world");
+    REQUIRE(editor.GetCursor() == 11);
+    REQUIRE(Row(window, 1) == "> hello world");
+    REQUIRE(window.Getyx() == PosYx{1, 13});
+
+    // Typing at the end only draws the new character
+    const auto drawn = editor.GetCharsDrawn();
+    Type(editor, "!");
+    REQUIRE(editor.GetCharsDrawn() == drawn + 1);
+
+    editor.HandleKey(Key::Home);
+    editor.HandleKey(CtrlKey('f'));
+    editor.HandleKey(Key::Dc);
+    REQUIRE(editor.GetLine() == "hllo world!");
+    editor.HandleKey(Key::Backspace);
+    REQUIRE(editor.GetLine() == "llo world!");
+    REQUIRE(editor.GetCursor() == 0);
+    editor.HandleKey(Key::Left);
+    REQUIRE(editor.GetCursor() == 0);
+    Type(editor, "he");
+    REQUIRE(Row(window, 1) == "> hello world!");
+    REQUIRE(window.Getyx() == PosYx{1, 4});
+
+    // Unbound keys are ignored
+    REQUIRE(editor.HandleKey(Key::F0 + 1) == LineEditor::Status::Editing);
+    REQUIRE(editor.GetLine() == "hello world!");
+
+    // Non-ASCII bytes are ignored
+    Type(editor, "\xc3\xa5");
+    REQUIRE(editor.GetLine() == "hello world!");
+    REQUIRE(editor.GetCursor() == 2);
+
+    // Kill and yank
+    editor.HandleKey(CtrlKey('e'));
+    editor.HandleKey(CtrlKey('w'));
+    REQUIRE(editor.GetLine() == "hello ");
+    REQUIRE(Row(window, 1) == "> hello");
+    editor.HandleKey(CtrlKey('a'));
+    editor.HandleKey(CtrlKey('y'));
+    REQUIRE(editor.GetLine() == "world!hello ");
+    editor.HandleKey(CtrlKey('k'));
+    REQUIRE(editor.GetLine() == "world!");
+    editor.HandleKey(CtrlKey('a'));
+    editor.HandleKey(CtrlKey('u'));
+    REQUIRE(editor.GetLine() == "world!");
+    editor.HandleKey(CtrlKey('e'));
+    editor.HandleKey(CtrlKey('u'));
+    REQUIRE(editor.GetLine().empty());
+    REQUIRE(Row(window, 1) == ">");
+
+    Type(editor, "ok");
+    REQUIRE(editor.HandleKey('\n') == LineEditor::Status::Accepted);
+    REQUIRE(editor.HandleKey('x') == LineEditor::Status::Accepted);
+    REQUIRE(editor.GetLine() == "ok");
+    REQUIRE(editor.GetHistory() == std::vector<std::string>{"ok"});
+
+    editor.Clear();
+    REQUIRE(editor.GetStatus() == LineEditor::Status::Editing);
+    Type(editor, "abc");
+    REQUIRE(editor.HandleKey(EscapeKey) == LineEditor::Status::Cancelled);
+    REQUIRE(editor.GetHistory() == std::vector<std::string>{"ok"});
+}
+
+TEST_CASE("LineEditor: Horizontal scrolling")
+{
+    const auto _ = Initscr();
+    auto window = Window({3, 10}, {0, 0});
+    auto editor = LineEditor{window, {0, 2}};
+
+    Type(editor, "0123456789");
+    REQUIRE(editor.GetCursor() == 10);
+    REQUIRE(Row(window, 0) == "  3456789");
+    REQUIRE(window.Getyx() == PosYx{0, 9});
+
+    editor.HandleKey(Key::Home);
+    REQUIRE(Row(window, 0) == "  01234567");
+    REQUIRE(window.Getyx() == PosYx{0, 2});
+}
+
+TEST_CASE("LineEditor: History")
+{
+    const auto _ = Initscr();
+    auto window = Window({3, 40}, {0, 0});
+    auto editor = LineEditor{window, {0, 0}};
+    editor.SetHistory({"git status", "make", "git log", "ls"});
+
+    editor.HandleKey(Key::Up);
+    REQUIRE(editor.GetLine() == "ls");
+    editor.HandleKey(Key::Up);
+    REQUIRE(editor.GetLine() == "git log");
+    editor.HandleKey(Key::Down);
+    editor.HandleKey(Key::Down);
+    REQUIRE(editor.GetLine().empty());
+
+    // Prefix search
+    Type(editor, "git");
+    editor.HandleKey(CtrlKey('p'));
+    REQUIRE(editor.GetLine() == "git log");
+    REQUIRE(Row(window, 0) == "git log");
+    editor.HandleKey(CtrlKey('p'));
+    REQUIRE(editor.GetLine() == "git status");
+    editor.HandleKey(CtrlKey('p'));
+    REQUIRE(editor.GetLine() == "git status");
+    editor.HandleKey(CtrlKey('n'));
+    editor.HandleKey(CtrlKey('n'));
+    REQUIRE(editor.GetLine() == "git");
+    REQUIRE(Row(window, 0) == "git");
+
+    editor.HandleKey(Key::Up);
+    editor.HandleKey('\r');
+    REQUIRE(editor.GetHistory().back() == "git log");
+    REQUIRE(editor.GetHistory().size() == 5);
+}
+
+TEST_CASE("LineEditor: Completion")
+{
+    const auto _ = Initscr();
+    auto window = Window({3, 40}, {0, 0});
+    auto editor = LineEditor{window, {0, 0}};
+    auto words = std::vector<std::string>{};
+    editor.SetCompleter([&] (std::string_view word)
+    {
+        words.emplace_back(word);
+        auto candidates = std::vector<std::string>{};
+        for (const auto* command : {"checkout", "cherry-pick", "commit"})
+        {
+            if (std::string_view{command}.substr(0, word.size()) == word) candidates.emplace_back(command);
+        }
+        return candidates;
+    });
+
+    Type(editor, "git ch\t");
+    REQUIRE(editor.GetLine() == "git che");
+    Type(editor, "c\t");
+    REQUIRE(editor.GetLine() == "git checkout ");
+    Type(editor, "x\t");
+    REQUIRE(editor.GetLine() == "git checkout x");
+    REQUIRE(words == std::vector<std::string>{"ch", "chec", "x"});
+}
@@ -0,0 +1,121 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/mouse_coalescer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+using namespace curses;
+
+namespace
+{
+
+Mevent Motion(int y, int x, Mmask modifiers = {})
+{
+    auto event = Mevent{};
+    event.y = y;
+    event.x = x;
+    event.bstate = Mmask::ReportMousePosition | modifiers;
+    return event;
+}
+
+Mevent Button(int y, int x, Mmask bstate)
+{
+    auto event = Mevent{};
+    event.y = y;
+    event.x = x;
+    event.bstate = bstate;
+    return event;
+}
+
+} // namespace
+
+TEST_CASE("MouseCoalescer::IsMotion")
+{
+    REQUIRE(MouseCoalescer::IsMotion(Motion(0, 0)));
+    REQUIRE(MouseCoalescer::IsMotion(Motion(0, 0, Mmask::ButtonShift | Mmask::ButtonCtrl)));
+    REQUIRE_FALSE(MouseCoalescer::IsMotion(Button(0, 0, Mmask::Button1Pressed)));
+    REQUIRE_FALSE(MouseCoalescer::IsMotion(Button(0, 0, Mmask::Button1Released | Mmask::ReportMousePosition)));
+    REQUIRE_FALSE(MouseCoalescer::IsMotion(Button(0, 0, Mmask{})));
+}
+
+TEST_CASE("MouseCoalescer::Coalesce")
+{
+    auto coalescer = MouseCoalescer{};
+
+    SECTION("Empty")
+    {
+        auto keys = std::array<int, 1>{};
+        auto mouse_events = std::array<Mevent, 1>{};
+        REQUIRE(coalescer.Coalesce(keys.data(), mouse_events.data(), 0) == 0);
+        REQUIRE(coalescer.GetMergedCount() == 0);
+    }
+
+    SECTION("Motion runs keep the last position")
+    {
+        auto keys = std::array<int, 8>{};
+        keys.fill(Key::Mouse);
+        keys[4] = 'a';
+        auto mouse_events = std::array<Mevent, 8>{
+            Motion(1, 1),
+            Motion(1, 2),
+            Motion(2, 3, Mmask::ButtonShift),
+            Button(2, 3, Mmask::Button1Pressed),
+            Mevent{},
+            Motion(3, 4),
+            Motion(4, 5),
+            Button(4, 5, Mmask::Button1Released),
+        };
+
+        const auto n = coalescer.Coalesce(keys.data(), mouse_events.data(), 8);
+        REQUIRE(n == 5);
+        REQUIRE(coalescer.GetMergedCount() == 3);
+
+        REQUIRE(keys[0] == Key::Mouse);
+        REQUIRE(mouse_events[0].Getyx() == PosYx{2, 3});
+        REQUIRE(mouse_events[0].bstate == (Mmask::ReportMousePosition | Mmask::ButtonShift));
+        REQUIRE(keys[1] == Key::Mouse);
+        REQUIRE(mouse_events[1].bstate == Mmask::Button1Pressed);
+        REQUIRE(keys[2] == 'a');
+        REQUIRE(keys[3] == Key::Mouse);
+        REQUIRE(mouse_events[3].Getyx() == PosYx{4, 5});
+        REQUIRE(keys[4] == Key::Mouse);
+        REQUIRE(mouse_events[4].bstate == Mmask::Button1Released);
+
+        // Nothing left to merge
+        REQUIRE(coalescer.Coalesce(keys.data(), mouse_events.data(), n) == n);
+        REQUIRE(coalescer.GetMergedCount() == 3);
+
+        coalescer.ResetMergedCount();
+        REQUIRE(coalescer.GetMergedCount() == 0);
+    }
+
+    SECTION("Motion that is not a mouse key is ignored")
+    {
+        auto keys = std::array<int, 3>{'x', 'y', 'z'};
+        auto mouse_events = std::array<Mevent, 3>{Motion(0, 0), Motion(0, 1), Motion(0, 2)};
+        REQUIRE(coalescer.Coalesce(keys.data(), mouse_events.data(), 3) == 3);
+        REQUIRE(keys == std::array<int, 3>{'x', 'y', 'z'});
+        REQUIRE(coalescer.GetMergedCount() == 0);
+    }
+}
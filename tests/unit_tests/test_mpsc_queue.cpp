@@ -0,0 +1,77 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/mpsc_queue.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace curses;
+
+TEST_CASE("MpscQueue: Single thread")
+{
+    auto queue = MpscQueue<std::unique_ptr<int>>{};
+    REQUIRE(queue.IsEmpty());
+    REQUIRE(!queue.TryPop());
+
+    queue.Push(std::make_unique<int>(1));
+    queue.Push(std::make_unique<int>(2));
+    REQUIRE(!queue.IsEmpty());
+    REQUIRE(**queue.TryPop() == 1);
+    REQUIRE(**queue.TryPop() == 2);
+    REQUIRE(!queue.TryPop());
+
+    queue.Push(std::make_unique<int>(3)); // Destroyed with queue
+}
+
+TEST_CASE("MpscQueue: Multiple producers")
+{
+    constexpr int NumProducers = 4;
+    constexpr int NumPerProducer = 10000;
+
+    auto queue = MpscQueue<int>{};
+    auto producers = std::vector<std::thread>{};
+    for (int p = 0; p < NumProducers; ++p)
+    {
+        producers.emplace_back([&queue, p]
+        {
+            for (int i = 0; i < NumPerProducer; ++i) queue.Push(p * NumPerProducer + i);
+        });
+    }
+
+    // Elements from each producer arrive in order
+    auto next = std::vector<int>(NumProducers, 0);
+    auto count = 0;
+    while (count < NumProducers * NumPerProducer)
+    {
+        const auto value = queue.TryPop();
+        if (!value) continue;
+        const auto p = *value / NumPerProducer;
+        REQUIRE(*value % NumPerProducer == next.at(p));
+        ++next.at(p);
+        ++count;
+    }
+    for (auto& producer : producers) producer.join();
+    REQUIRE(!queue.TryPop());
+}
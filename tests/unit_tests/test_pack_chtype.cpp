@@ -0,0 +1,55 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/curses.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace curses;
+
+TEST_CASE("PackChtype")
+{
+    const auto attr = Attr::Bold | ColorPair(3);
+
+    // Lengths around the SIMD block sizes
+    for (const auto n : {0, 1, 15, 16, 17, 31, 32, 33, 100})
+    {
+        auto text = std::string{};
+        for (int i = 0; i < n; ++i) text.push_back(static_cast<char>(1 + i % 255));
+
+        auto out = std::vector<Chtype>(n + 1, Chtype{0xDEADU});
+        PackChtype(text, attr, out.data());
+        for (int i = 0; i < n; ++i)
+        {
+            REQUIRE(out.at(i).Get() == (static_cast<unsigned char>(text.at(i)) | static_cast<unsigned>(attr)));
+        }
+        REQUIRE(out.at(n) == Chtype{0xDEADU});
+    }
+
+    auto out = std::vector<Chtype>(2);
+    PackChtype("a\xFF", Attr::Reverse, out.data());
+    REQUIRE(out.at(0) == ('a' | Attr::Reverse));
+    REQUIRE(out.at(1).GetChar() == '\xFF');
+    REQUIRE(out.at(1).GetAttr() == Attr::Reverse);
+}
@@ -0,0 +1,85 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/pad_viewport.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+
+using namespace curses;
+
+TEST_CASE("PadViewport")
+{
+    const auto _ = Initscr();
+    REQUIRE(Lines() >= 5);
+    REQUIRE(Cols() >= 10);
+
+    const auto source = [] (Pad& pad, int pad_line, int line)
+    {
+        pad.Addstr({pad_line, 0}, std::to_string(line));
+    };
+    auto viewport = PadViewport{{5, 10}, {0, 0}, 100000, 10, source};
+    const auto line_at_top = [&]
+    {
+        const auto str = viewport.GetPad().Instr({viewport.GetTop() - viewport.GetBandFirst(), 0});
+        return std::stoi(str);
+    };
+
+    REQUIRE(Result::Ok == viewport.Refresh());
+    REQUIRE(viewport.GetPad().Getmaxyx().y == 15);
+    REQUIRE(viewport.GetFetchCount() == 15);
+    REQUIRE(line_at_top() == 0);
+
+    // Within the band: nothing is fetched
+    viewport.ScrollBy(10);
+    REQUIRE(Result::Ok == viewport.Refresh());
+    REQUIRE(viewport.GetFetchCount() == 15);
+    REQUIRE(line_at_top() == 10);
+
+    // Just outside the band: only new lines are fetched
+    viewport.ScrollBy(1);
+    REQUIRE(Result::Ok == viewport.Refresh());
+    REQUIRE(viewport.GetFetchCount() == 15 + 6);
+    REQUIRE(viewport.GetBandFirst() == 6);
+    REQUIRE(line_at_top() == 11);
+
+    viewport.ScrollBy(-10);
+    REQUIRE(Result::Ok == viewport.Refresh());
+    REQUIRE(line_at_top() == 1);
+
+    // Jump: the whole band is fetched
+    const auto count = viewport.GetFetchCount();
+    viewport.ScrollTo(50000);
+    REQUIRE(Result::Ok == viewport.Noutrefresh());
+    REQUIRE(viewport.GetFetchCount() == count + 15);
+    REQUIRE(line_at_top() == 50000);
+
+    viewport.ScrollTo(1000000);
+    REQUIRE(viewport.GetTop() == 100000 - 5);
+    REQUIRE(Result::Ok == viewport.Refresh());
+    REQUIRE(line_at_top() == 100000 - 5);
+
+    viewport.SetNumLines(3);
+    REQUIRE(viewport.GetTop() == 0);
+    REQUIRE(Result::Ok == viewport.Refresh());
+    REQUIRE(line_at_top() == 0);
+}
@@ -0,0 +1,129 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/render_thread.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace curses;
+
+TEST_CASE("RenderThread")
+{
+    constexpr int NumProducers = 4;
+    constexpr int NumPerProducer = 1000;
+
+    auto pane = std::optional<Window>{};
+    auto counters = std::vector<int>(NumProducers, 0);
+    auto text = std::string{};
+    auto render_thread_id = std::thread::id{};
+    {
+        auto render = RenderThread{1000};
+        REQUIRE(render.IsRunning());
+        render.Post([&]
+        {
+            render_thread_id = std::this_thread::get_id();
+            pane.emplace(SizeLinesCols{1, 10}, PosYx{});
+        });
+
+        auto producers = std::vector<std::thread>{};
+        for (int p = 0; p < NumProducers; ++p)
+        {
+            producers.emplace_back([&, p]
+            {
+                for (int i = 0; i < NumPerProducer; ++i)
+                {
+                    render.Post([&, p]
+                    {
+                        ++counters.at(p);
+                        pane->Addstr({0, 0}, std::to_string(counters.at(p)));
+                        render.GetScheduler().Schedule(*pane);
+                    });
+                }
+            });
+        }
+        for (auto& producer : producers) producer.join();
+
+        render.Post([&]
+        {
+            text = pane->Instr({0, 0}, 4);
+            render.GetScheduler().Unschedule(*pane);
+            pane.reset();
+        });
+        render.Stop();
+        REQUIRE(!render.IsRunning());
+        render.Stop();
+        REQUIRE(render.GetCommandCount() == 2 + NumProducers * NumPerProducer);
+    }
+
+    REQUIRE(render_thread_id != std::thread::id{});
+    REQUIRE(render_thread_id != std::this_thread::get_id());
+    REQUIRE(text == std::to_string(NumPerProducer));
+    for (const auto count : counters) REQUIRE(count == NumPerProducer);
+    REQUIRE(Isendwin());
+}
+
+TEST_CASE("RenderThread: Idle")
+{
+    auto render = RenderThread{1000};
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+
+    // A command posted while the render thread waits wakes it
+    auto ran = std::promise<void>{};
+    render.Post([&] { ran.set_value(); });
+    REQUIRE(ran.get_future().wait_for(std::chrono::seconds{5}) == std::future_status::ready);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    render.Stop();
+    REQUIRE(render.GetCommandCount() == 1);
+    REQUIRE(Isendwin());
+}
+
+TEST_CASE("RenderThread: Exceptions")
+{
+    auto ran_after = false;
+    {
+        auto render = RenderThread{1000};
+        render.Post([] { throw std::runtime_error{"command failed"}; });
+        render.Post([] { throw std::logic_error{"second failure"}; });
+        render.Post([&] { ran_after = true; });
+        REQUIRE_THROWS_AS(render.Stop(), std::runtime_error);
+        REQUIRE(!render.IsRunning());
+        REQUIRE(render.GetCommandCount() == 3);
+        REQUIRE_NOTHROW(render.Stop());
+    }
+    REQUIRE(ran_after);
+    REQUIRE(Isendwin());
+
+    // The destructor drops the exception
+    {
+        auto render = RenderThread{1000};
+        render.Post([] { throw std::runtime_error{"command failed"}; });
+    }
+    REQUIRE(Isendwin());
+}
@@ -0,0 +1,81 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/resize_coordinator.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace curses;
+
+TEST_CASE("ResizeCoordinator")
+{
+    const auto _ = Initscr();
+    const auto term = SizeLinesCols{Lines(), Cols()};
+
+    auto main = Window{{term.lines - 1, term.cols}, {}};
+    auto status = Window{{1, term.cols}, {term.lines - 1, 0}};
+    auto sub = main.Derwin({2, 2}, {0, 0});
+    main.Addstr({0, 0}, "main");
+
+    auto exposed = std::vector<RectMinMax>{};
+    auto coordinator = ResizeCoordinator{};
+    coordinator.Add(
+            main,
+            ResizeCoordinator::Fill(0, 0, 1, 0),
+            [&] (Window&, RectMinMax rect) { exposed.push_back(rect); });
+    coordinator.Add(
+            status,
+            [] (SizeLinesCols t) { return ResizeCoordinator::Geometry{{1, t.cols}, {t.lines - 1, 0}}; });
+
+    REQUIRE(Result::Ok == coordinator.Update());
+    REQUIRE(exposed.empty());
+    REQUIRE(coordinator.GetExposedCells() == 0);
+
+    // Grow: only the new rows and columns are exposed
+    REQUIRE(Result::Ok == coordinator.Resize({term.lines + 2, term.cols + 3}));
+    REQUIRE(main.Getmaxyx() == PosYx{term.lines + 1, term.cols + 3});
+    REQUIRE(status.Getbegyx() == PosYx{term.lines + 1, 0});
+    REQUIRE(status.Getmaxyx() == PosYx{1, term.cols + 3});
+    REQUIRE(main.Instr({0, 0}, 4) == "main");
+    REQUIRE(exposed.size() == 2);
+    REQUIRE(exposed.at(0) == RectMinMax{{term.lines - 1, 0}, {term.lines, term.cols + 2}});
+    REQUIRE(exposed.at(1) == RectMinMax{{0, term.cols}, {term.lines - 2, term.cols + 2}});
+    REQUIRE(coordinator.GetExposedCells() == 2L * (term.cols + 3) + 3L * (term.lines - 1) + 3L);
+
+    // Shrink: nothing is exposed, and the subwindow is still valid
+    exposed.clear();
+    REQUIRE(Result::Ok == coordinator.Resize({term.lines - 2, term.cols - 5}));
+    REQUIRE(exposed.empty());
+    REQUIRE(main.Getmaxyx() == PosYx{term.lines - 3, term.cols - 5});
+    REQUIRE(status.Getbegyx() == PosYx{term.lines - 3, 0});
+    REQUIRE(main.Instr({0, 0}, 4) == "main");
+    REQUIRE(sub.GetParent() == &main);
+    REQUIRE(Result::Ok == sub.Addch({1, 0}, 'x'));
+    REQUIRE(main.Inch({1, 0}) == 'x');
+
+    // Only main is placed and exposed
+    coordinator.Remove(status);
+    REQUIRE(Result::Ok == coordinator.Resize(term));
+    REQUIRE(exposed.size() == 2);
+    REQUIRE(coordinator.GetExposedCells() == 2L * term.cols + 5L * (term.lines - 3));
+}
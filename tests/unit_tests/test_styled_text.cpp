@@ -0,0 +1,81 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/styled_text.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+using namespace curses;
+
+namespace
+{
+
+constexpr auto Label = Markup("CPU: [b]42%[/b]");
+static_assert(Label.Size() == 8);
+static_assert(Label.Cells()[4] == Chtype{' '});
+static_assert(Label.Cells()[5] == ('4' | Attr::Bold));
+
+} // namespace
+
+TEST_CASE("Markup")
+{
+    constexpr auto plain = Markup("a[[b]");
+    REQUIRE(plain.Size() == 4);
+    REQUIRE(plain.Cells()[1] == '[');
+    REQUIRE(plain.Cells()[3] == ']');
+
+    constexpr auto nested = Markup("[pair=2]a[u]b[pair=3]c[/pair]d[/u][/pair]e");
+    REQUIRE(nested.Size() == 5);
+    REQUIRE(nested.Cells()[0] == Chtype('a', Attr::Normal, 2));
+    REQUIRE(nested.Cells()[1] == Chtype('b', Attr::Underline, 2));
+    REQUIRE(nested.Cells()[2] == Chtype('c', Attr::Underline, 3));
+    REQUIRE(nested.Cells()[3] == Chtype('d', Attr::Underline, 2));
+    REQUIRE(nested.Cells()[4] == 'e');
+
+    constexpr auto empty = Markup("");
+    REQUIRE(empty.Size() == 0);
+}
+
+TEST_CASE("Markup: Invalid")
+{
+    // Compile errors when parsed in a constant expression
+    REQUIRE_THROWS_AS(Markup("[b]x"), std::invalid_argument);
+    REQUIRE_THROWS_AS(Markup("x[/b]"), std::invalid_argument);
+    REQUIRE_THROWS_AS(Markup("[b][u]x[/b][/u]"), std::invalid_argument);
+    REQUIRE_THROWS_AS(Markup("[nope]x[/nope]"), std::invalid_argument);
+    REQUIRE_THROWS_AS(Markup("[pair=256]x[/pair]"), std::invalid_argument);
+    REQUIRE_THROWS_AS(Markup("[b"), std::invalid_argument);
+}
+
+TEST_CASE("Markup: Addchstr")
+{
+    const auto _ = Initscr();
+    auto window = Window({1, 20}, {});
+
+    REQUIRE(Result::Ok == window.Addchstr({0, 1}, Label));
+    REQUIRE(window.Inch({0, 0}) == ' ');
+    REQUIRE(window.Inch({0, 1}) == 'C');
+    REQUIRE(window.Inch({0, 6}) == ('4' | Attr::Bold));
+    REQUIRE(window.Inch({0, 8}) == ('%' | Attr::Bold));
+    REQUIRE(window.Inch({0, 9}) == ' ');
+}
@@ -0,0 +1,146 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/curses.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <string>
+#include <utility>
+
+using namespace curses;
+
+TEST_CASE("Window damage: Disabled by default")
+{
+    const auto _ = Initscr();
+    auto window = Window{{5, 10}, {}};
+    REQUIRE(!window.IsTrackingDamage());
+    window.Addstr({1, 1}, "abc");
+    REQUIRE(window.GetDamage() == std::nullopt);
+    REQUIRE(window.FlushDamage() == Result::Ok);
+}
+
+TEST_CASE("Window damage: Output functions")
+{
+    const auto _ = Initscr();
+    auto window = Window{{5, 10}, {}};
+    window.TrackDamage();
+    REQUIRE(window.IsTrackingDamage());
+    REQUIRE(window.GetDamage() == std::nullopt);
+
+    window.Addstr({1, 2}, "abc");
+    REQUIRE(window.GetDamage() == RectMinMax{{1, 2}, {1, 4}});
+    window.Addch('d');
+    REQUIRE(window.GetDamage() == RectMinMax{{1, 2}, {1, 5}});
+
+    window.ClearDamage();
+    window.Addchstr({3, 8}, std::basic_string<Chtype>(5, 'x'));
+    REQUIRE(window.GetDamage() == RectMinMax{{3, 8}, {3, 9}});
+
+    window.ClearDamage();
+    window.Chgat({2, 3}, 2, Attr::Bold);
+    REQUIRE(window.GetDamage() == RectMinMax{{2, 3}, {2, 4}});
+
+    window.ClearDamage();
+    window.Vline({1, 1}, '|', 3);
+    window.Hline({4, 5}, '-', 2);
+    REQUIRE(window.GetDamage() == RectMinMax{{1, 1}, {4, 6}});
+
+    window.ClearDamage();
+    window.Addstr({2, 8}, "abcd");
+    REQUIRE(window.GetDamage() == RectMinMax{{2, 0}, {3, 9}});
+
+    window.ClearDamage();
+    window.Insch({0, 4}, 'i');
+    REQUIRE(window.GetDamage() == RectMinMax{{0, 4}, {0, 9}});
+
+    window.ClearDamage();
+    window.Erase();
+    REQUIRE(window.GetDamage() == RectMinMax{{0, 0}, {4, 9}});
+}
+
+TEST_CASE("Window damage: FlushDamage")
+{
+    const auto _ = Initscr();
+    auto window = Window{{5, 10}, {}};
+    window.TrackDamage();
+
+    window.Addstr({0, 0}, "abc");
+    REQUIRE(window.IsWintouched());
+    REQUIRE(window.FlushDamage() == Result::Ok);
+    REQUIRE(!window.IsWintouched());
+    REQUIRE(window.GetDamage() == std::nullopt);
+    REQUIRE(window.FlushDamage() == Result::Ok);
+
+    // Noutrefresh fails for a pad, so the damage is kept
+    auto pad = Pad{{5, 10}};
+    pad.TrackDamage();
+    pad.Addstr({1, 1}, "abc");
+    REQUIRE(pad.FlushDamage() == Result::Err);
+    REQUIRE(pad.GetDamage() == RectMinMax{{1, 1}, {1, 3}});
+}
+
+TEST_CASE("Window damage: Large counts")
+{
+    const auto _ = Initscr();
+    auto window = Window{{5, 10}, {}};
+    window.TrackDamage();
+
+    window.Hline({1, 2}, '-', std::numeric_limits<int>::max());
+    REQUIRE(window.GetDamage() == RectMinMax{{1, 2}, {1, 9}});
+    window.ClearDamage();
+    window.Vline({2, 3}, '|', std::numeric_limits<int>::max());
+    REQUIRE(window.GetDamage() == RectMinMax{{2, 3}, {4, 3}});
+}
+
+TEST_CASE("Window damage: Move and copy")
+{
+    const auto _ = Initscr();
+    auto window0 = Window{{5, 10}, {}};
+    window0.TrackDamage();
+    window0.Addch({1, 1}, 'a');
+
+    auto window1 = window0;
+    REQUIRE(window1.IsTrackingDamage());
+    REQUIRE(window1.GetDamage() == RectMinMax{{1, 1}, {1, 1}});
+
+    auto window2 = std::move(window0);
+    REQUIRE(window2.IsTrackingDamage());
+    REQUIRE(window2.GetDamage() == RectMinMax{{1, 1}, {1, 1}});
+    REQUIRE(!window0.IsTrackingDamage()); // NOLINT: use after move
+}
+
+TEST_CASE("Window damage: Bottom-right corner")
+{
+    const auto _ = Initscr();
+    auto window = Window{{5, 10}, {}};
+    window.TrackDamage();
+
+    // ncurses writes the cell but returns Err, since the cursor can't advance
+    REQUIRE(Result::Err == window.Addch({4, 9}, 'x'));
+    REQUIRE(window.GetDamage() == RectMinMax{{4, 9}, {4, 9}});
+    REQUIRE(window.FlushDamage() == Result::Ok);
+
+    REQUIRE(Result::Err == window.Addstr({4, 8}, "yz"));
+    REQUIRE(window.GetDamage() == RectMinMax{{4, 8}, {4, 9}});
+    REQUIRE(window.Inch({4, 9}).GetChar() == 'z');
+}
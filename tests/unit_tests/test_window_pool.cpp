@@ -0,0 +1,96 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/window_pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+using namespace curses;
+
+TEST_CASE("WindowPool")
+{
+    const auto _ = Initscr();
+    auto pool = WindowPool{2};
+
+    auto* raw = static_cast<WINDOW*>(nullptr);
+    {
+        auto popup = pool.Acquire({3, 10}, {1, 2});
+        REQUIRE(popup);
+        raw = popup->Get();
+        REQUIRE(popup->Getmaxyx() == PosYx{3, 10});
+        REQUIRE(popup->Getbegyx() == PosYx{1, 2});
+        popup->Attron(Attr::Bold);
+        popup->Addstr({1, 1}, "tooltip");
+        popup->Scrollok();
+    }
+    REQUIRE(pool.GetNumFree() == 1);
+    REQUIRE(pool.GetStats().allocated == 1);
+
+    // Same size class: the window is reused and reset
+    auto popup = pool.Acquire({4, 12}, {5, 6});
+    REQUIRE(popup->Get() == raw);
+    REQUIRE(pool.GetNumFree() == 0);
+    REQUIRE(pool.GetStats().reused == 1);
+    REQUIRE(popup->Getmaxyx() == PosYx{4, 12});
+    REQUIRE(popup->Getbegyx() == PosYx{5, 6});
+    REQUIRE(popup->Getyx() == PosYx{0, 0});
+    REQUIRE(popup->Attrget() == Attr::Normal);
+    REQUIRE_FALSE(popup->IsScrollok());
+    REQUIRE(popup->Instr({1, 0}, 12) == std::string(12, ' '));
+
+    // Another size class allocates
+    auto large = pool.Acquire({10, 40});
+    REQUIRE(large->Get() != raw);
+    REQUIRE(pool.GetStats().allocated == 2);
+
+    auto moved = std::move(popup);
+    REQUIRE_FALSE(popup); // NOLINT: Use after move
+    moved.Release();
+    REQUIRE_FALSE(moved);
+    REQUIRE(pool.GetNumFree() == 1);
+    large.Release();
+    REQUIRE(pool.GetNumFree() == 2);
+}
+
+TEST_CASE("WindowPool: Reserve and limits")
+{
+    const auto _ = Initscr();
+    auto pool = WindowPool{2};
+
+    pool.Reserve({5, 5}, 2);
+    REQUIRE(pool.GetNumFree() == 2);
+    REQUIRE(pool.GetStats().allocated == 2);
+    {
+        auto a = pool.Acquire({5, 6});
+        auto b = pool.Acquire({7, 8});
+        auto c = pool.Acquire({8, 8});
+        REQUIRE(pool.GetStats().reused == 2);
+        REQUIRE(pool.GetStats().allocated == 3);
+        REQUIRE(c->Getmaxyx() == PosYx{8, 8});
+    }
+    REQUIRE(pool.GetNumFree() == 2);
+    REQUIRE(pool.GetStats().dropped == 1);
+
+    REQUIRE_THROWS_AS(pool.Acquire({5, 5}, {-1, 0}), std::runtime_error);
+}
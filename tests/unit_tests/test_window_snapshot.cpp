@@ -0,0 +1,74 @@
+// MIT License
+//
+// Copyright (c) 2024 fekstrom
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#include "curses_cpp/window_snapshot.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace curses;
+
+TEST_CASE("Window snapshot: Snapshot, Restore")
+{
+    const auto _ = Initscr();
+    auto window = Window{{3, 4}, {}};
+    window.Addstr({0, 0}, "abcd");
+    window.Addstr({1, 0}, "efgh");
+    window.Addstr({2, 0}, "ijk");
+    window.Addch({2, 3}, 'l' | Attr::Bold);
+    window.Move({1, 2});
+
+    auto snapshot = window.Snapshot();
+    REQUIRE(snapshot.cells.GetSize() == SizeLinesCols{3, 4});
+    REQUIRE(snapshot.cursor == PosYx{1, 2});
+    REQUIRE(window.Getyx() == PosYx{1, 2});
+    REQUIRE(snapshot.cells[{0, 0}] == 'a');
+    REQUIRE(snapshot.cells[{1, 3}] == 'h');
+    REQUIRE(snapshot.cells[{2, 0}] == 'i');
+    REQUIRE(snapshot.cells[{2, 3}] == ('l' | Attr::Bold));
+
+    window.Erase();
+    window.Move({0, 0});
+    REQUIRE(Result::Ok == window.Restore(snapshot));
+    REQUIRE(window.Getyx() == PosYx{1, 2});
+    REQUIRE(window.Instr({0, 0}) == "abcd");
+    REQUIRE(window.Instr({1, 0}) == "efgh");
+    REQUIRE(window.Instr({2, 0}) == "ijkl");
+
+    // The buffer is reused
+    const auto* data = snapshot.cells.Data();
+    window.Addch({0, 0}, 'A');
+    window.Snapshot(snapshot);
+    REQUIRE(snapshot.cells.Data() == data);
+    REQUIRE(snapshot.cells[{0, 0}] == 'A');
+}
+
+TEST_CASE("Window snapshot: Restore to smaller window")
+{
+    const auto _ = Initscr();
+    auto window0 = Window{{3, 4}, {}};
+    window0.Addstr({0, 0}, "abcd");
+    window0.Move({2, 3});
+    const auto snapshot = window0.Snapshot();
+
+    auto window1 = Window{{1, 2}, {}};
+    REQUIRE(Result::Ok == window1.Restore(snapshot));
+    REQUIRE(window1.Instr({0, 0}) == "ab");
+}